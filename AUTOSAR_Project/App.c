@@ -11,6 +11,7 @@
 
 #include "App.h"
 #include "Button.h"
+#include "Debounce.h"
 #include "Led.h"
 #include "Port.h"
 #include "Dio.h"
@@ -28,12 +29,18 @@ void Init_Task(void)
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
 
+    /* Initialize the debounced inputs with their current levels */
+    Debounce_Init();
+
+    /* Sample the button only after an edge on its pin */
+    Port_SetEdgeCallBack(PortConf_SW1_PIN_ID_INDEX, Button_EdgeNotification);
+
 }
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Task executes every 20 Mili-seconds to debounce the button and the other inputs */
 void Button_Task(void)
 {
-    Button_RefreshState();
+    Debounce_MainFunction();
 }
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
@@ -14,14 +14,10 @@
 #include "Std_Types.h"
 #include "Button_Cfg.h"
 
-/* Description: Read the Button state Pressed/Released */
+/* Description: Read the debounced Button state Pressed/Released */
 uint8 Button_GetState(void);
 
-/* 
- * Description: This function is called every 20ms by Os Task and it responsible for Updating 
- *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
- *		        and it should be in a RELEASED State if the button is released for 60ms.
- */   
-void Button_RefreshState(void);
+/* Description: Called from the edge interrupt of the button pin to sample it at the next debounce */
+void Button_EdgeNotification(void);
 
 #endif /* BUTTON_H */
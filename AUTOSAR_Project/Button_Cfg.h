@@ -22,5 +22,8 @@
 /* Set the Button Pin Number */
 #define BUTTON_PIN_NUM DioConf_SW1_CHANNEL_NUM
 
+/* Set the Button Input in the debounced inputs table */
+#define BUTTON_INPUT_ID DebounceConf_SW1_INPUT_ID_INDEX
+
 
 #endif /* BUTTON_CFG_H_ */
@@ -0,0 +1,182 @@
+/******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce.c
+ *
+ * Description: Source file for Debounce Module.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+#include "Dio.h"
+#include "Debounce.h"
+
+/* Check that the number of entries matches the configured number of inputs */
+#define DEBOUNCE_INPUT_COUNT(ID, PORT, PIN, THR, EDGE)    + 1U
+#if ((0U DEBOUNCE_CONFIGURED_INPUTS_TABLE(DEBOUNCE_INPUT_COUNT, 0U)) != DEBOUNCE_CONFIGURED_INPUTS)
+  #error "The number of debounced inputs does not match DEBOUNCE_CONFIGURED_INPUTS"
+#endif
+
+/* Check that every threshold fits in the 3-bit counter of its input */
+#define DEBOUNCE_INPUT_THRESHOLD_ERROR(ID, PORT, PIN, THR, EDGE)    || ((THR) < 1U) || ((THR) > DEBOUNCE_MAX_THRESHOLD)
+#if (0U DEBOUNCE_CONFIGURED_INPUTS_TABLE(DEBOUNCE_INPUT_THRESHOLD_ERROR, 0U))
+  #error "The threshold of a debounced input is out of range"
+#endif
+
+/* Per-input array entry */
+#define DEBOUNCE_INPUT_ENTRY(ID, PORT, PIN, THR, EDGE) \
+    {PORT, (uint8)(1U << (PIN))},
+
+/* Bit of the pin in the configuration of port ID in-case COND is true */
+#define DEBOUNCE_PIN_BIT(ID, PORT, PIN, COND) \
+    ((((ID) == (PORT)) && (COND)) ? (1U << (PIN)) : 0U)
+
+#define DEBOUNCE_PORT_MASK(ID, PORT, PIN, THR, EDGE)          | DEBOUNCE_PIN_BIT(ID, PORT, PIN, TRUE)
+#define DEBOUNCE_PORT_EDGE(ID, PORT, PIN, THR, EDGE)          | DEBOUNCE_PIN_BIT(ID, PORT, PIN, ((EDGE) == STD_ON))
+#define DEBOUNCE_PORT_THRESHOLD0(ID, PORT, PIN, THR, EDGE)    | DEBOUNCE_PIN_BIT(ID, PORT, PIN, (((THR) & 1U) != 0U))
+#define DEBOUNCE_PORT_THRESHOLD1(ID, PORT, PIN, THR, EDGE)    | DEBOUNCE_PIN_BIT(ID, PORT, PIN, (((THR) & 2U) != 0U))
+#define DEBOUNCE_PORT_THRESHOLD2(ID, PORT, PIN, THR, EDGE)    | DEBOUNCE_PIN_BIT(ID, PORT, PIN, (((THR) & 4U) != 0U))
+
+/* Debounce configuration of port ID, OR-ing the bits of all its inputs */
+#define DEBOUNCE_PORT(ID) \
+    { \
+        (uint8)(0U DEBOUNCE_CONFIGURED_INPUTS_TABLE(DEBOUNCE_PORT_MASK, ID)), \
+        (uint8)(0U DEBOUNCE_CONFIGURED_INPUTS_TABLE(DEBOUNCE_PORT_EDGE, ID)), \
+        (uint8)(0U DEBOUNCE_CONFIGURED_INPUTS_TABLE(DEBOUNCE_PORT_THRESHOLD0, ID)), \
+        (uint8)(0U DEBOUNCE_CONFIGURED_INPUTS_TABLE(DEBOUNCE_PORT_THRESHOLD1, ID)), \
+        (uint8)(0U DEBOUNCE_CONFIGURED_INPUTS_TABLE(DEBOUNCE_PORT_THRESHOLD2, ID)) \
+    }
+
+static const Debounce_InputConfigType Debounce_Inputs[DEBOUNCE_CONFIGURED_INPUTS] =
+{
+    DEBOUNCE_CONFIGURED_INPUTS_TABLE(DEBOUNCE_INPUT_ENTRY, 0U)
+};
+
+static const Debounce_PortConfigType Debounce_Ports[DIO_NUMBER_OF_PORTS] =
+{
+    DEBOUNCE_PORT(0U),
+    DEBOUNCE_PORT(1U),
+    DEBOUNCE_PORT(2U),
+    DEBOUNCE_PORT(3U),
+    DEBOUNCE_PORT(4U),
+    DEBOUNCE_PORT(5U)
+};
+
+/* Debounced state of the inputs of each port */
+static uint8 g_Debounce_State[DIO_NUMBER_OF_PORTS];
+
+/* Vertical counters ... bit n of g_Count_Bitk is bit k of the counter of pin n */
+static uint8 g_Count_Bit0[DIO_NUMBER_OF_PORTS];
+static uint8 g_Count_Bit1[DIO_NUMBER_OF_PORTS];
+static uint8 g_Count_Bit2[DIO_NUMBER_OF_PORTS];
+
+/* Set by the edge interrupt of an input pin, cleared when its port is sampled */
+static volatile boolean g_Edge_Pending[DIO_NUMBER_OF_PORTS];
+
+/*******************************************************************************************************************/
+void Debounce_Init(void)
+{
+    uint8 portIndex;
+
+    for(portIndex = 0; portIndex < DIO_NUMBER_OF_PORTS; portIndex++)
+    {
+        g_Count_Bit0[portIndex]   = 0;
+        g_Count_Bit1[portIndex]   = 0;
+        g_Count_Bit2[portIndex]   = 0;
+        g_Edge_Pending[portIndex] = FALSE;
+
+        if(Debounce_Ports[portIndex].Mask != 0)
+        {
+            g_Debounce_State[portIndex] = Dio_ReadPort(portIndex) & Debounce_Ports[portIndex].Mask;
+        }
+        else
+        {
+            g_Debounce_State[portIndex] = 0;
+        }
+    }
+}
+
+/*******************************************************************************************************************/
+void Debounce_MainFunction(void)
+{
+    const Debounce_PortConfigType * Port_Ptr = NULL_PTR;
+    uint8 changed;
+    uint8 reached;
+    uint8 portIndex;
+
+    for(portIndex = 0; portIndex < DIO_NUMBER_OF_PORTS; portIndex++)
+    {
+        Port_Ptr = &Debounce_Ports[portIndex];
+
+        if(Port_Ptr->Mask == 0)
+        {
+            /* No debounced inputs in this port */
+            continue;
+        }
+        else if((Port_Ptr->Edge_Mask == Port_Ptr->Mask) && (g_Edge_Pending[portIndex] == FALSE) && \
+                ((g_Count_Bit0[portIndex] | g_Count_Bit1[portIndex] | g_Count_Bit2[portIndex]) == 0))
+        {
+            /* No edges and no changing inputs ... the port does not need to be sampled */
+            continue;
+        }
+        else
+        {
+            g_Edge_Pending[portIndex] = FALSE;
+        }
+
+        /* Inputs whose level is different from their debounced state */
+        changed = (Dio_ReadPort(portIndex) ^ g_Debounce_State[portIndex]) & Port_Ptr->Mask;
+
+        /* Increment the counters of the changed inputs and clear the counters of the others */
+        g_Count_Bit2[portIndex] = (g_Count_Bit2[portIndex] ^ (g_Count_Bit1[portIndex] & g_Count_Bit0[portIndex])) & changed;
+        g_Count_Bit1[portIndex] = (g_Count_Bit1[portIndex] ^ g_Count_Bit0[portIndex]) & changed;
+        g_Count_Bit0[portIndex] = (uint8)(~g_Count_Bit0[portIndex]) & changed;
+
+        /* Inputs whose counter is equal to their threshold take the new level */
+        reached = changed & (uint8)(~((g_Count_Bit0[portIndex] ^ Port_Ptr->Threshold_Bit0) |
+                                      (g_Count_Bit1[portIndex] ^ Port_Ptr->Threshold_Bit1) |
+                                      (g_Count_Bit2[portIndex] ^ Port_Ptr->Threshold_Bit2)));
+
+        g_Debounce_State[portIndex] ^= reached;
+        g_Count_Bit0[portIndex] &= (uint8)(~reached);
+        g_Count_Bit1[portIndex] &= (uint8)(~reached);
+        g_Count_Bit2[portIndex] &= (uint8)(~reached);
+    }
+}
+
+/*******************************************************************************************************************/
+Dio_LevelType Debounce_GetInputState(uint8 InputId)
+{
+    Dio_LevelType state = STD_LOW;
+
+    if(InputId < DEBOUNCE_CONFIGURED_INPUTS)
+    {
+        if((g_Debounce_State[Debounce_Inputs[InputId].Port_Num] & Debounce_Inputs[InputId].Pin_Mask) != 0)
+        {
+            state = STD_HIGH;
+        }
+    }
+    return state;
+}
+
+/*******************************************************************************************************************/
+Dio_PortLevelType Debounce_GetPortState(Dio_PortType PortId)
+{
+    Dio_PortLevelType state = 0;
+
+    if(PortId < DIO_NUMBER_OF_PORTS)
+    {
+        state = g_Debounce_State[PortId];
+    }
+    return state;
+}
+
+/*******************************************************************************************************************/
+void Debounce_EdgeNotification(Dio_PortType PortId)
+{
+    if(PortId < DIO_NUMBER_OF_PORTS)
+    {
+        g_Edge_Pending[PortId] = TRUE;
+    }
+}
+/*******************************************************************************************************************/
@@ -0,0 +1,61 @@
+/******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce.h
+ *
+ * Description: Header file for Debounce Module.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+#ifndef DEBOUNCE_H
+#define DEBOUNCE_H
+
+#include "Std_Types.h"
+#include "Dio.h"
+#include "Debounce_Cfg.h"
+
+/* Description: Structure of one debounced input:
+ *  1. the Dio port of the input
+ *  2. the bit of the input in the port
+ */
+typedef struct
+{
+    Dio_PortType Port_Num;
+    uint8 Pin_Mask;
+}Debounce_InputConfigType;
+
+/* Description: Structure of the debounced inputs of one port:
+ *  1. the debounced pins of the port --> bit n set if pin n is debounced
+ *  2. the pins which raise an edge interrupt
+ *  3. bit 0, 1 and 2 of the threshold of each pin, one byte per threshold bit
+ */
+typedef struct
+{
+    uint8 Mask;
+    uint8 Edge_Mask;
+    uint8 Threshold_Bit0;
+    uint8 Threshold_Bit1;
+    uint8 Threshold_Bit2;
+}Debounce_PortConfigType;
+
+/* Description: Read the configured ports once and take their levels as the initial states */
+void Debounce_Init(void);
+
+/* 
+ * Description: This function is called every 20ms by Os Task, it reads each configured port
+ *              once and debounces all its inputs together. An input changes its state after
+ *              Threshold consecutive samples at the new level.
+ */
+void Debounce_MainFunction(void);
+
+/* Description: Read the debounced state of one input STD_HIGH/STD_LOW */
+Dio_LevelType Debounce_GetInputState(uint8 InputId);
+
+/* Description: Read the debounced state of all the inputs of one port, one bit per pin */
+Dio_PortLevelType Debounce_GetPortState(Dio_PortType PortId);
+
+/* Description: Called from the edge interrupt of an input pin to sample its port at the next call */
+void Debounce_EdgeNotification(Dio_PortType PortId);
+
+#endif /* DEBOUNCE_H */
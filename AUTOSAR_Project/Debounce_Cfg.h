@@ -0,0 +1,35 @@
+/******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Debounce Module
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef DEBOUNCE_CFG_H_
+#define DEBOUNCE_CFG_H_
+
+/* Number of the debounced inputs */
+#define DEBOUNCE_CONFIGURED_INPUTS          (1U)
+
+/* Input Index in the debounced inputs table */
+#define DebounceConf_SW1_INPUT_ID_INDEX     (uint8)0x00
+
+/* Largest threshold of the 3-bit counter of each input */
+#define DEBOUNCE_MAX_THRESHOLD              (7U)
+
+/*
+ * Debounced inputs, each entry is:
+ * DEBOUNCE_INPUT(PORT_ID, Port,                  Pin,                      Threshold, Edge)
+ *
+ * Threshold: number of consecutive samples (1 to 7) at the new level before the input changes its state.
+ * Edge: STD_ON in-case the pin raises an edge interrupt, a port whose inputs all raise edge interrupts
+ *       is only sampled after an edge notification or while one of its inputs is changing.
+ */
+#define DEBOUNCE_CONFIGURED_INPUTS_TABLE(DEBOUNCE_INPUT, PORT_ID) \
+    DEBOUNCE_INPUT(PORT_ID, DioConf_SW1_PORT_NUM,  DioConf_SW1_CHANNEL_NUM,  3U,        STD_ON)
+
+#endif /* DEBOUNCE_CFG_H_ */
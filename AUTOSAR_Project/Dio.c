@@ -11,6 +11,7 @@
 
 #include "Dio.h"
 #include "Dio_Regs.h"
+#include "Reg_Access.h"
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 
@@ -24,6 +25,24 @@
 
 #endif
 
+/* Values written to a channel masked GPIODATA address, only the channel bit is taken by the hardware */
+#define DIO_CHANNEL_HIGH               (0xFFU)
+#define DIO_CHANNEL_LOW                (0x00U)
+
+/* Mask selecting all the 8 pins of a port */
+#define DIO_PORT_ALL_PINS              (0xFFU)
+
+/* Base address of each port, the GPIODATA masked addresses are relative to it */
+STATIC const uint32 Dio_PortBaseAddress[DIO_NUMBER_OF_PORTS] =
+{
+    DIO_PORT_BASE_ADDRESS(0U), /* PORTA */
+    DIO_PORT_BASE_ADDRESS(1U), /* PORTB */
+    DIO_PORT_BASE_ADDRESS(2U), /* PORTC */
+    DIO_PORT_BASE_ADDRESS(3U), /* PORTD */
+    DIO_PORT_BASE_ADDRESS(4U), /* PORTE */
+    DIO_PORT_BASE_ADDRESS(5U)  /* PORTF */
+};
+
 STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
@@ -73,7 +92,7 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 ************************************************************************************/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	uint32 Data_Address = 0U;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -105,31 +124,17 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* Point to the GPIODATA address masked to this channel, other pins of the port are never touched */
+		Data_Address = Dio_PortChannels[ChannelId].Data_Address;
 		if(Level == STD_HIGH)
 		{
-			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			/* Write Logic High ... single store, no read-modify-write */
+			REG_WRITE(Data_Address, DIO_CHANNEL_HIGH);
 		}
 		else if(Level == STD_LOW)
 		{
-			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			/* Write Logic Low ... single store, no read-modify-write */
+			REG_WRITE(Data_Address, DIO_CHANNEL_LOW);
 		}
 	}
 	else
@@ -152,7 +157,7 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 ************************************************************************************/
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	uint32 Data_Address = 0U;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -185,24 +190,10 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
+		/* Point to the GPIODATA address masked to this channel, other pins of the port are never touched */
+		Data_Address = Dio_PortChannels[ChannelId].Data_Address;
+		/* Read the required channel ... the masked read returns 0 for all the other pins */
+		if(REG_READ(Data_Address) != DIO_CHANNEL_LOW)
 		{
 			output = STD_HIGH;
 		}
@@ -218,6 +209,241 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
         return output;
 }
 
+/************************************************************************************
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all channels of that port.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Read the 8 pins of the port with a single access */
+		output = (Dio_PortLevelType)REG_READ(DIO_MASKED_DATA_REG_ADDRESS(Dio_PortBaseAddress[PortId], DIO_PORT_ALL_PINS));
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WritePort
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a value of the port.
+************************************************************************************/
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Write the 8 pins of the port with a single store, the hardware ignores the input pins */
+		REG_WRITE(DIO_MASKED_DATA_REG_ADDRESS(Dio_PortBaseAddress[PortId], DIO_PORT_ALL_PINS), Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadChannelGroup
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to read a subset of the adjoining bits of a port, shifted to the LSB.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the group port is within the valid range */
+	else if (DIO_NUMBER_OF_PORTS <= ChannelGroupIdPtr->PortIndex)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Single read of the group pins only ... the other pins of the port are read as 0 */
+		output = (Dio_PortLevelType)(REG_READ(DIO_MASKED_DATA_REG_ADDRESS(Dio_PortBaseAddress[ChannelGroupIdPtr->PortIndex],
+		                                                                  ChannelGroupIdPtr->mask)) >> ChannelGroupIdPtr->offset);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelGroup
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a subset of the adjoining bits of a port to a specified level.
+************************************************************************************/
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the group port is within the valid range */
+	else if (DIO_NUMBER_OF_PORTS <= ChannelGroupIdPtr->PortIndex)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/*
+		 * Single store to the GPIODATA address masked to the group pins, all the group pins change
+		 * together and the hardware ignores the level bits outside the group mask
+		 */
+		REG_WRITE(DIO_MASKED_DATA_REG_ADDRESS(Dio_PortBaseAddress[ChannelGroupIdPtr->PortIndex], ChannelGroupIdPtr->mask),
+		          ((uint32)Level << ChannelGroupIdPtr->offset));
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
 /************************************************************************************
 * Service Name: Dio_GetVersionInfo
 * Service ID[hex]: 0x12
@@ -271,7 +497,7 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	uint32 Data_Address = 0U;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -304,31 +530,17 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* Point to the GPIODATA address masked to this channel, other pins of the port are never touched */
+		Data_Address = Dio_PortChannels[ChannelId].Data_Address;
 		/* Read the required channel and write the required level */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
+		if(REG_READ(Data_Address) != DIO_CHANNEL_LOW)
 		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			REG_WRITE(Data_Address, DIO_CHANNEL_LOW);
 			output = STD_LOW;
 		}
 		else
 		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			REG_WRITE(Data_Address, DIO_CHANNEL_HIGH);
 			output = STD_HIGH;
 		}
 	}
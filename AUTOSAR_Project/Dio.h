@@ -161,28 +161,37 @@ typedef struct
 	Dio_PortType Port_Num;
 	/* Member contains the ID of the Channel*/
 	Dio_ChannelType Ch_Num;
+	/* Member contains the GPIODATA address masked to this channel only */
+	uint32 Data_Address;
 }Dio_ConfigChannel;
 
 /* Data Structure required for initializing the Dio Driver */
 typedef struct Dio_ConfigType
 {
 	Dio_ConfigChannel Channels[DIO_CONFIGURED_CHANNLES];
+	Dio_ChannelGroupType Groups[DIO_CONFIGURED_GROUPS];
 } Dio_ConfigType;
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
-/* Function for DIO read Channel API */
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
-/* Function for DIO read Port API */
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr);
+
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level);
+
+/* Function for DIO read Channel API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
-/* Function for DIO write Port API */
+/* Function for DIO write Channel API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
 /* Function for DIO Initialization API */
@@ -35,6 +35,9 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/* Number of the GPIO Ports (PORTA to PORTF) accessible by Dio_ReadPort/Dio_WritePort */
+#define DIO_NUMBER_OF_PORTS                  (6U)
+
 /* Number of the configured Dio Channels */
 #define DIO_CONFIGURED_CHANNLES              (2U)
 
@@ -50,4 +53,20 @@
 #define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
 #define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
 
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_GROUPS                (1U)
+
+/* Channel Group Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_RGB_LED_GROUP_INDEX          (uint8)0x00
+
+/* Channel Group symbolic name to be used with Dio_ReadChannelGroup/Dio_WriteChannelGroup */
+#define DioConf_RGB_LED_GROUP_PTR            (&Dio_Configuration.Groups[DioConf_RGB_LED_GROUP_INDEX])
+
+/* DIO Configured Channel Group Port ID's */
+#define DioConf_RGB_LED_GROUP_PORT_NUM       (Dio_PortType)5 /* PORTF */
+
+/* DIO Configured Channel Group masks and offsets */
+#define DioConf_RGB_LED_GROUP_MASK           (uint8)0x0E /* Pins 1, 2 and 3 in PORTF */
+#define DioConf_RGB_LED_GROUP_OFFSET         (uint8)1
+
 #endif /* DIO_CFG_H */
@@ -10,6 +10,7 @@
  ******************************************************************************/
 
 #include "Dio.h"
+#include "Dio_Regs.h"
 
 /*
  * Module Version 1.0.0
@@ -41,6 +42,19 @@
 
 /* PB structure used with Dio_Init API */
 const Dio_ConfigType Dio_Configuration = {
-                                             DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-				                             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
-				                         };
+                                             {
+                                                 {
+                                                     DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
+                                                     DIO_MASKED_DATA_ADDRESS(DioConf_LED1_PORT_NUM, (1U << DioConf_LED1_CHANNEL_NUM))
+                                                 },
+                                                 {
+                                                     DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM,
+                                                     DIO_MASKED_DATA_ADDRESS(DioConf_SW1_PORT_NUM, (1U << DioConf_SW1_CHANNEL_NUM))
+                                                 }
+                                             },
+                                             {
+                                                 {
+                                                     DioConf_RGB_LED_GROUP_MASK,DioConf_RGB_LED_GROUP_OFFSET,DioConf_RGB_LED_GROUP_PORT_NUM
+                                                 }
+                                             }
+                                         };
@@ -21,4 +21,19 @@
 #define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
 #define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
 
+/* GPIO Ports base addresses, PORTA to PORTD are at 0x40004000 + n * 0x1000, PORTE and PORTF at 0x40024000 + n * 0x1000 */
+#define DIO_PORT_BASE_ADDRESS(PORT_ID) \
+    (((PORT_ID) < 4U) ? (0x40004000UL + ((uint32)(PORT_ID) * 0x1000UL)) : (0x40024000UL + ((uint32)((PORT_ID) - 4U) * 0x1000UL)))
+
+/*
+ * GPIODATA is mapped on 256 addresses, the address bits [9:2] mask the data bits:
+ * a read returns 0 for the pins not selected by MASK and a write only changes the selected pins.
+ */
+#define DIO_MASKED_DATA_ADDRESS(PORT_ID, MASK) \
+    (DIO_PORT_BASE_ADDRESS(PORT_ID) + ((uint32)(MASK) << 2))
+
+/* GPIODATA address of the port at BASE_ADDRESS masked to the pins set in MASK, accessed through REG_READ/REG_WRITE */
+#define DIO_MASKED_DATA_REG_ADDRESS(BASE_ADDRESS, MASK) \
+    ((BASE_ADDRESS) + ((uint32)(MASK) << 2))
+
 #endif /* DIO_REGS_H */
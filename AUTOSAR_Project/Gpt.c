@@ -11,11 +11,15 @@
 
 #include "Gpt.h"
 #include "tm4c123gh6pm_registers.h"
+#include "Reg_Access.h"
 
 #define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
 #define SYSTICK_INTERRUPT_PRIORITY  3
 #define SYSTICK_PRIORITY_BITS_POS   29
 
+#define DEBUG_DEMCR_TRCENA_MASK     0x01000000
+#define DWT_CTRL_CYCCNTENA_MASK     0x00000001
+
 /* Global pointer to function used to point upper layer functions
  * to be used in Call Back */
 static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
@@ -49,16 +53,16 @@ void SysTick_Handler(void)
 ************************************************************************************/
 void SysTick_Start(uint16 Tick_Time)
 {
-    SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
-    SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
+    REG_WRITE(SYSTICK_CTRL_REG_ADDRESS, 0);                     /* Disable the SysTick Timer by Clear the ENABLE Bit */
+    REG_WRITE(SYSTICK_RELOAD_REG_ADDRESS, (GPT_SYSTEM_CLOCK_CYCLES_PER_MS * Tick_Time) - 1);   /* Set the Reload value to count n miliseconds */
+    REG_WRITE(SYSTICK_CURRENT_REG_ADDRESS, 0);                  /* Clear the Current Register value */
     /* Configure the SysTick Control Register 
      * Enable the SysTick Timer (ENABLE = 1)
      * Enable SysTick Interrupt (INTEN = 1)
      * Choose the clock source to be System Clock (CLK_SRC = 1) */
-    SYSTICK_CTRL_REG   |= 0x07;
+    REG_WRITE(SYSTICK_CTRL_REG_ADDRESS, REG_READ(SYSTICK_CTRL_REG_ADDRESS) | 0x07);
     /* Assign priority level 3 to the SysTick Interrupt */
-    NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
+    REG_WRITE(NVIC_SYSTEM_PRI3_REG_ADDRESS, (REG_READ(NVIC_SYSTEM_PRI3_REG_ADDRESS) & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS));
 }
 
 /************************************************************************************
@@ -73,7 +77,7 @@ void SysTick_Start(uint16 Tick_Time)
 ************************************************************************************/
 void SysTick_Stop(void)
 {
-    SYSTICK_CTRL_REG = 0; /* Disable the SysTick Timer by Clear the ENABLE Bit */
+    REG_WRITE(SYSTICK_CTRL_REG_ADDRESS, 0); /* Disable the SysTick Timer by Clear the ENABLE Bit */
 }
 
 /************************************************************************************
@@ -90,3 +94,83 @@ void SysTick_SetCallBack(void(*Ptr2Func)(void))
 {
     g_SysTick_Call_Back_Ptr = Ptr2Func;
 }
+
+/************************************************************************************
+* Service Name: SysTick_GetCurrentValue
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - SysTick Current Register value
+* Description: Function to read the SysTick counter, it counts down from the Reload value to 0.
+************************************************************************************/
+uint32 SysTick_GetCurrentValue(void)
+{
+    return REG_READ(SYSTICK_CURRENT_REG_ADDRESS);
+}
+
+/************************************************************************************
+* Service Name: SysTick_SetReloadValue
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Reload_Value - Number of clock cycles of the next SysTick period - 1
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to change the SysTick Reload value, the running count is not changed
+*              and the new value is used from the next reload of the counter.
+************************************************************************************/
+void SysTick_SetReloadValue(uint32 Reload_Value)
+{
+    REG_WRITE(SYSTICK_RELOAD_REG_ADDRESS, Reload_Value);
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetReloadValue
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - SysTick Reload Register value
+* Description: Function to read the SysTick Reload value, the tick period is Reload + 1 clock cycles.
+************************************************************************************/
+uint32 SysTick_GetReloadValue(void)
+{
+    return REG_READ(SYSTICK_RELOAD_REG_ADDRESS);
+}
+
+/************************************************************************************
+* Service Name: DWT_CycleCounterStart
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the free running DWT cycle counter:
+*              - Enable the DWT unit (TRCENA = 1)
+*              - Clear the counter and enable it (CYCCNTENA = 1)
+************************************************************************************/
+void DWT_CycleCounterStart(void)
+{
+    REG_WRITE(DEBUG_DEMCR_REG_ADDRESS, REG_READ(DEBUG_DEMCR_REG_ADDRESS) | DEBUG_DEMCR_TRCENA_MASK);
+    REG_WRITE(DWT_CYCCNT_REG_ADDRESS, 0);
+    REG_WRITE(DWT_CTRL_REG_ADDRESS, REG_READ(DWT_CTRL_REG_ADDRESS) | DWT_CTRL_CYCCNTENA_MASK);
+}
+
+/************************************************************************************
+* Service Name: DWT_GetCycleCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - DWT cycle counter value
+* Description: Function to read the DWT cycle counter, it counts up every clock cycle and wraps around.
+************************************************************************************/
+uint32 DWT_GetCycleCount(void)
+{
+    return REG_READ(DWT_CYCCNT_REG_ADDRESS);
+}
@@ -14,6 +14,16 @@
 
 #include "Std_Types.h"
 
+/*******************************************************************************
+ *                              Definitions                                    *
+ *******************************************************************************/
+
+/* SysTick clock cycles in 1 ms with the 16Mhz System clock */
+#define GPT_SYSTEM_CLOCK_CYCLES_PER_MS   (16000U)
+
+/* Largest value of the 24-bit SysTick Reload register */
+#define GPT_SYSTICK_MAX_RELOAD_VALUE     (0x00FFFFFFU)
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -57,4 +67,67 @@ void SysTick_Stop(void);
 ************************************************************************************/
 void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
+/************************************************************************************
+* Service Name: SysTick_GetCurrentValue
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - SysTick Current Register value
+* Description: Function to read the SysTick counter, it counts down from the Reload value to 0.
+************************************************************************************/
+uint32 SysTick_GetCurrentValue(void);
+
+/************************************************************************************
+* Service Name: SysTick_SetReloadValue
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Reload_Value - Number of clock cycles of the next SysTick period - 1
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to change the SysTick Reload value, the running count is not changed
+*              and the new value is used from the next reload of the counter.
+************************************************************************************/
+void SysTick_SetReloadValue(uint32 Reload_Value);
+
+/************************************************************************************
+* Service Name: SysTick_GetReloadValue
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - SysTick Reload Register value
+* Description: Function to read the SysTick Reload value, the tick period is Reload + 1 clock cycles.
+************************************************************************************/
+uint32 SysTick_GetReloadValue(void);
+
+/************************************************************************************
+* Service Name: DWT_CycleCounterStart
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the free running DWT cycle counter:
+*              - Enable the DWT unit (TRCENA = 1)
+*              - Clear the counter and enable it (CYCCNTENA = 1)
+************************************************************************************/
+void DWT_CycleCounterStart(void);
+
+/************************************************************************************
+* Service Name: DWT_GetCycleCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - DWT cycle counter value
+* Description: Function to read the DWT cycle counter, it counts up every clock cycle and wraps around.
+************************************************************************************/
+uint32 DWT_GetCycleCount(void);
+
 #endif /* GPT_H */
@@ -10,10 +10,11 @@
  ******************************************************************************/
 
 #include "tm4c123gh6pm_registers.h"
+#include "Reg_Access.h"
 
 void Mcu_Init(void)
 {
     /* Enable clock for All PORTs and wait for clock to start */
-    SYSCTL_RCGCGPIO_REG |= 0x3F;
-    while(!(SYSCTL_PRGPIO_REG & 0x3F));
+    REG_WRITE(SYSCTL_RCGCGPIO_REG_ADDRESS, REG_READ(SYSCTL_RCGCGPIO_REG_ADDRESS) | 0x3F);
+    while(!(REG_READ(SYSCTL_PRGPIO_REG_ADDRESS) & 0x3F));
 }
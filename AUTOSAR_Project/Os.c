@@ -15,6 +15,12 @@
 #include "Led.h"
 #include "Gpt.h"
 
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+#include "tm4c123gh6pm_registers.h"
+#include "Reg_Access.h"
+#endif
+
+#ifndef REG_ACCESS_SIMULATION
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
 
@@ -27,18 +33,555 @@
 /* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
 #define Disable_Faults()       __asm(" CPSID F ")
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+/* Wait For Interrupt ... This Macro put the CPU in the sleep mode until an interrupt is pending */
+#define Wait_For_Interrupt()   __asm(" WFI ")
+#else
+/* Host build (host/Makefile) ... the interrupt masking and the sleep of the core are not simulated */
+#define Enable_Exceptions()
+#define Disable_Exceptions()
+#define Enable_Faults()
+#define Disable_Faults()
+#define Wait_For_Interrupt()
+#endif
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+/* Trigger the PendSV exception to switch to the highest priority ready task, ICSR ignores the zero bits of a write */
+#define OS_PENDSV_SET_MASK           0x10000000
+#define Os_RequestContextSwitch()    REG_WRITE(NVIC_SYSTEM_INTCTRL_ADDRESS, OS_PENDSV_SET_MASK)
+
+/* PendSV has the lowest priority level 7 ... the context switch runs after all the other interrupts */
+#define OS_PENDSV_PRIORITY_MASK      0xFF1FFFFF
+#define OS_PENDSV_PRIORITY           7
+#define OS_PENDSV_PRIORITY_BITS_POS  21
+
+/* The idle task is the Os_Scheduler loop, it is after the tasks of the task table */
+#define OS_IDLE_TASK_ID              OS_NUMBER_OF_TASKS
+
+/* Initial xPSR of a task with only the Thumb state bit set */
+#define OS_INITIAL_XPSR              0x01000000
+
+/* Exception return to the Thread mode using the PSP without a floating point frame */
+#define OS_INITIAL_EXC_RETURN        0xFFFFFFFD
+
+/* Number of words of the initial task frame ... R0-R3, R12, LR, PC, xPSR and R4-R11, EXC_RETURN */
+#define OS_INITIAL_FRAME_WORDS       17
+
+/* Description: Switch to the stack of the idle task and jump to it with the interrupts enabled (Os_Port.asm) */
+extern void Os_PortStartIdle(uint32 * Stack_Top, void (*Idle_Task)(void));
+#endif
+
+/* Description: Called by PendSV_Handler (Os_Port.asm) with the stack pointer of the running task after its context
+ * is saved, returns the stack pointer of the task to be restored */
+uint32 * Os_SwitchContext(uint32 * Stack_Pointer);
+
+/* Global variable store the Os Time in ticks */
+static volatile uint32 g_Time_Tick_Count = 0;
+
+/* Global variable store the position of the current tick inside the hyperperiod */
+static volatile uint32 g_Hyperperiod_Tick = 0;
+
+/* Global variable store the number of ticks not yet handled by the scheduler */
+static volatile uint32 g_Pending_Ticks = 0;
+
+/* Global variable store the position inside the hyperperiod of the last tick handled by the scheduler */
+static uint32 g_Release_Tick = 0;
+
+/* Number of releases of each task dropped or executed after the next release of the same task */
+static uint32 g_Task_Deadline_Misses[OS_NUMBER_OF_TASKS];
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_REPORT)
+/* Global pointer to function called with the ID of each task that missed a release */
+static void (*g_Overrun_Call_Back_Ptr)(uint8 TaskId) = NULL_PTR;
+#endif
+
+/* Global variable store the SysTick clock cycles of one tick */
+static uint32 g_Tick_Cycles = 0;
+
+#if (OS_TICKLESS_MODE == STD_ON)
+/* Global variable store the length in ticks of the SysTick period running now */
+static uint32 g_Running_Period_Ticks = 1;
+
+/* Global variable store the length in ticks of the SysTick period in the Reload register */
+static uint32 g_Reload_Period_Ticks = 1;
+
+/* Number of ticks from each tick of the hyperperiod to the next tick releasing a task */
+static uint32 g_Next_Release_Ticks[OS_HYPERPERIOD_TICKS];
+#endif
+
+#if (OS_LOW_POWER_IDLE == STD_ON)
+/* Global variable store the idle clock cycles of the current hyperperiod */
+static uint32 g_Idle_Cycles = 0;
+
+/* Global variable store the idle clock cycles of the last completed hyperperiod */
+static volatile uint32 g_Last_Hyperperiod_Idle_Cycles = 0;
+#endif
+
+#if (OS_TASK_INSTRUMENTATION == STD_ON)
+/* Execution time of each task in clock cycles */
+static uint32 g_Task_Min_Cycles[OS_NUMBER_OF_TASKS];
+static uint32 g_Task_Max_Cycles[OS_NUMBER_OF_TASKS];
+static uint64 g_Task_Total_Cycles[OS_NUMBER_OF_TASKS];
+static uint32 g_Task_Runs[OS_NUMBER_OF_TASKS];
+static uint32 g_Task_Overruns[OS_NUMBER_OF_TASKS];
+
+/* Global variable store the clock cycles spent in the tasks during the current hyperperiod */
+static uint32 g_Busy_Cycles = 0;
+
+/* Global variable store the clock cycles spent in the tasks during the last completed hyperperiod */
+static volatile uint32 g_Last_Hyperperiod_Busy_Cycles = 0;
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+/* Clock cycles of the current run of each task up to its last switch out ... the preempted time is not counted */
+static uint32 g_Task_Run_Cycles[OS_NUMBER_OF_TASKS];
+
+/* Global variable store the cycle counter when the running task was switched in */
+static uint32 g_Switch_In_Cycles = 0;
+#endif
+#endif
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+/* Stack of each task and of the idle task ... 8-byte aligned as required at the exception entry */
+static uint64 g_Task_Stack[OS_NUMBER_OF_TASKS + 1][OS_TASK_STACK_SIZE / 8];
+
+/* Saved stack pointer of each task and of the idle task */
+static uint32 * g_Task_Stack_Ptr[OS_NUMBER_OF_TASKS + 1];
+
+/* Tasks released and not finished yet ... bit n set if task n in Os_TaskTable is ready */
+static volatile uint32 g_Ready_Mask = 0;
+
+/* Tasks that have a context on their stack ... a ready task not started yet begins from a new frame */
+static uint32 g_Started_Mask = 0;
+
+/* Number of releases of each task not finished yet */
+static uint32 g_Task_Activations[OS_NUMBER_OF_TASKS];
+
+/* Global variable store the task running now */
+static volatile uint8 g_Current_Task = OS_IDLE_TASK_ID;
+#endif
+
+/* Tasks released at each tick of the hyperperiod ... bit n set if task n in Os_TaskTable is released */
+static uint32 g_Tick_Task_Mask[OS_HYPERPERIOD_TICKS];
+
+/*********************************************************************************************/
+/* Description: Precompute the released tasks of each tick of the hyperperiod from the task table,
+ * the periods and offsets are checked against OS_BASE_TIME and OS_HYPERPERIOD in Os_Cfg.h */
+static void Os_BuildSchedule(void)
+{
+    uint32 tick;
+    uint32 time;
+    uint8 taskIndex;
+
+    for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+    {
+        /* Tick 0 of the hyperperiod is the time OS_HYPERPERIOD, 2*OS_HYPERPERIOD, ... */
+        time = (tick == 0) ? OS_HYPERPERIOD : (tick * OS_BASE_TIME);
+        g_Tick_Task_Mask[tick] = 0;
+
+        for(taskIndex = 0; taskIndex < OS_NUMBER_OF_TASKS; taskIndex++)
+        {
+            if((time >= Os_TaskTable[taskIndex].Offset) && \
+               (((time - Os_TaskTable[taskIndex].Offset) % Os_TaskTable[taskIndex].Period) == 0))
+            {
+                g_Tick_Task_Mask[tick] |= ((uint32)1 << taskIndex);
+            }
+        }
+    }
+
+#if (OS_TICKLESS_MODE == STD_ON)
+    /* Distance to the next release ... a whole hyperperiod in-case no task is configured */
+    for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+    {
+        g_Next_Release_Ticks[tick] = OS_HYPERPERIOD_TICKS;
+
+        for(time = 1; time <= OS_HYPERPERIOD_TICKS; time++)
+        {
+            if(g_Tick_Task_Mask[(tick + time) % OS_HYPERPERIOD_TICKS] != 0)
+            {
+                g_Next_Release_Ticks[tick] = time;
+                break;
+            }
+        }
+    }
+#endif
+}
+
+#if (OS_LOW_POWER_IDLE == STD_ON)
+/*********************************************************************************************/
+/* Description: Sleep until the next interrupt in-case no tick is waiting and count the idle clock cycles */
+static void Os_Idle(void)
+{
+    uint32 start;
+    uint32 end;
+
+    /*
+     * Check the flag with the interrupts disabled ... a tick can not be lost between the check and the WFI,
+     * a pending interrupt still wakes up the CPU and its ISR runs after the interrupts are enabled again
+     */
+    Disable_Exceptions();
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    if(g_Ready_Mask == 0)
+#else
+    if(g_Pending_Ticks == 0)
+#endif
+    {
+        start = SysTick_GetCurrentValue();
+        Wait_For_Interrupt();
+        end   = SysTick_GetCurrentValue();
+
+        /* SysTick counts down ... in-case it reloaded during the sleep add the cycles before the reload */
+        if(end <= start)
+        {
+            g_Idle_Cycles += (start - end);
+        }
+        else
+        {
+            g_Idle_Cycles += start + (SysTick_GetReloadValue() + 1 - end);
+        }
+    }
+    Enable_Exceptions();
+}
+
+/*********************************************************************************************/
+uint8 Os_GetIdlePercentage(void)
+{
+    /* Clock cycles in 1% of the hyperperiod */
+    uint32 percent_cycles = (g_Tick_Cycles * OS_HYPERPERIOD_TICKS) / 100;
+    uint8 percentage = 0;
+
+    /* g_Tick_Cycles is set by Os_start ... nothing is measured before it */
+    if(percent_cycles != 0)
+    {
+        percentage = (uint8)(g_Last_Hyperperiod_Idle_Cycles / percent_cycles);
+    }
+    return percentage;
+}
+#endif
+
+#if (OS_TASK_INSTRUMENTATION == STD_ON)
+/*********************************************************************************************/
+/* Description: Clear the execution time statistics and start the cycle counter */
+static void Os_InstrumentationInit(void)
+{
+    uint8 taskIndex;
+
+    for(taskIndex = 0; taskIndex < OS_NUMBER_OF_TASKS; taskIndex++)
+    {
+        g_Task_Min_Cycles[taskIndex] = 0xFFFFFFFF;
+    }
+    DWT_CycleCounterStart();
+}
+
+/*********************************************************************************************/
+/* Description: Run one task and update its execution time statistics */
+static void Os_RunTask(uint8 taskIndex)
+{
+    uint32 tick = g_Time_Tick_Count;
+    uint32 cycles;
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    /* Os_SwitchContext adds the cycles of the task up to each switch out and restarts the count at each switch in */
+    Disable_Exceptions();
+    g_Task_Run_Cycles[taskIndex] = 0;
+    g_Switch_In_Cycles = DWT_GetCycleCount();
+    Enable_Exceptions();
+
+    Os_TaskTable[taskIndex].Task_Ptr();
+
+    Disable_Exceptions();
+    cycles = g_Task_Run_Cycles[taskIndex] + (DWT_GetCycleCount() - g_Switch_In_Cycles);
+    Enable_Exceptions();
+#else
+    uint32 start;
+
+    start  = DWT_GetCycleCount();
+    Os_TaskTable[taskIndex].Task_Ptr();
+    cycles = DWT_GetCycleCount() - start; /* the counter wraps around ... unsigned difference is still valid */
+#endif
+
+    if(cycles < g_Task_Min_Cycles[taskIndex])
+    {
+        g_Task_Min_Cycles[taskIndex] = cycles;
+    }
+    if(cycles > g_Task_Max_Cycles[taskIndex])
+    {
+        g_Task_Max_Cycles[taskIndex] = cycles;
+    }
+    g_Task_Total_Cycles[taskIndex] += cycles;
+    g_Task_Runs[taskIndex]++;
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    /* The task itself ran longer than one tick ... being preempted over a tick is not an overrun */
+    (void)tick;
+    if(cycles > g_Tick_Cycles)
+#else
+    /* The next tick came before the task finished */
+    if(g_Time_Tick_Count != tick)
+#endif
+    {
+        g_Task_Overruns[taskIndex]++;
+    }
+
+    /* The busy cycles are moved to the last hyperperiod by the timer interrupt */
+    Disable_Exceptions();
+    g_Busy_Cycles += cycles;
+    Enable_Exceptions();
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskStats(uint8 TaskId, Os_TaskStatsType * Stats)
+{
+    Std_ReturnType result = E_NOT_OK;
+
+    if((TaskId < OS_NUMBER_OF_TASKS) && (Stats != NULL_PTR))
+    {
+        Stats->Min_Cycles     = (g_Task_Runs[TaskId] == 0) ? 0 : g_Task_Min_Cycles[TaskId];
+        Stats->Max_Cycles     = g_Task_Max_Cycles[TaskId];
+        Stats->Average_Cycles = (g_Task_Runs[TaskId] == 0) ? 0 : (uint32)(g_Task_Total_Cycles[TaskId] / g_Task_Runs[TaskId]);
+        Stats->Runs           = g_Task_Runs[TaskId];
+        Stats->Overruns       = g_Task_Overruns[TaskId];
+        result = E_OK;
+    }
+    return result;
+}
+
+/*********************************************************************************************/
+uint8 Os_GetCpuLoad(void)
+{
+    /* Clock cycles in 1% of the hyperperiod */
+    uint32 percent_cycles = (g_Tick_Cycles * OS_HYPERPERIOD_TICKS) / 100;
+    uint8 percentage = 0;
+
+    /* g_Tick_Cycles is set by Os_start ... nothing is measured before it */
+    if(percent_cycles != 0)
+    {
+        percentage = (uint8)(g_Last_Hyperperiod_Busy_Cycles / percent_cycles);
+    }
+    return percentage;
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: Execute the tasks set in task_mask in the task table order */
+static void Os_RunTasks(uint32 task_mask)
+{
+    uint8 taskIndex;
+
+    /* Only the released tasks are visited */
+    for(taskIndex = 0; task_mask != 0; taskIndex++)
+    {
+        if(task_mask & 1)
+        {
+#if (OS_TASK_INSTRUMENTATION == STD_ON)
+            Os_RunTask(taskIndex);
+#else
+            Os_TaskTable[taskIndex].Task_Ptr();
+#endif
+        }
+        task_mask >>= 1;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Count a missed release for each task set in missed_mask and report it */
+static void Os_CountMisses(uint32 missed_mask)
+{
+    uint8 taskIndex;
+
+    for(taskIndex = 0; missed_mask != 0; taskIndex++)
+    {
+        if(missed_mask & 1)
+        {
+            g_Task_Deadline_Misses[taskIndex]++;
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_REPORT)
+            if(g_Overrun_Call_Back_Ptr != NULL_PTR)
+            {
+                (*g_Overrun_Call_Back_Ptr)(taskIndex); /* report the task that missed a release */
+            }
+#endif
+        }
+        missed_mask >>= 1;
+    }
+}
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+/*********************************************************************************************/
+/* Description: Called from the timer interrupt to make the tasks released in the pending ticks ready */
+static void Os_ActivateTasks(void)
+{
+    uint32 released_mask;
+    uint32 missed_mask;
+    uint8 taskIndex;
+
+    while(g_Pending_Ticks != 0)
+    {
+        g_Pending_Ticks--;
+        g_Release_Tick++;
+        if(g_Release_Tick == OS_HYPERPERIOD_TICKS)
+        {
+            g_Release_Tick = 0;
+        }
+        released_mask = g_Tick_Task_Mask[g_Release_Tick];
+
+        /* A task released again while it is still ready missed a release */
+        missed_mask = released_mask & g_Ready_Mask;
+        if(missed_mask != 0)
+        {
+            Os_CountMisses(missed_mask);
+        }
+
+        for(taskIndex = 0; released_mask != 0; taskIndex++)
+        {
+            if(released_mask & 1)
+            {
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_CATCH_UP)
+                g_Task_Activations[taskIndex]++;      /* the missed release is executed after the running one */
+#else
+                g_Task_Activations[taskIndex] = 1;    /* the missed release is dropped */
+#endif
+            }
+            released_mask >>= 1;
+        }
+        g_Ready_Mask |= g_Tick_Task_Mask[g_Release_Tick];
+    }
+
+    /* Switch in-case a task with a higher priority than the running one is ready */
+    if((g_Ready_Mask & (((uint32)1 << g_Current_Task) - 1)) != 0)
+    {
+        Os_RequestContextSwitch();
+    }
+}
+
+/*********************************************************************************************/
+/* Description: First function of each task activation ... runs the task then gives the CPU to the next ready task */
+static void Os_TaskEntry(void)
+{
+    uint8 taskIndex = g_Current_Task;
+    uint32 task_bit = ((uint32)1 << taskIndex);
+
+    Os_RunTasks(task_bit);
+
+    Disable_Exceptions();
+    g_Task_Activations[taskIndex]--;
+    if(g_Task_Activations[taskIndex] == 0)
+    {
+        g_Ready_Mask &= ~task_bit;
+    }
+    g_Started_Mask &= ~task_bit;    /* the next activation begins from a new frame */
+    Os_RequestContextSwitch();
+    Enable_Exceptions();
+
+    /* PendSV switches to the next task here and this context is never restored */
+    while(1)
+    {
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Prepare the stack of a task as if it was interrupted just before Os_TaskEntry */
+static uint32 * Os_InitTaskStack(uint8 taskIndex)
+{
+    uint32 * Stack_Ptr = (uint32 *)&g_Task_Stack[taskIndex][OS_TASK_STACK_SIZE / 8];
+    uint8 word;
+
+    Stack_Ptr -= OS_INITIAL_FRAME_WORDS;
+    for(word = 0; word < OS_INITIAL_FRAME_WORDS; word++)
+    {
+        Stack_Ptr[word] = 0;
+    }
+
+    /* Software saved part ... R4-R11 then EXC_RETURN */
+    Stack_Ptr[8]  = OS_INITIAL_EXC_RETURN;
+    /* Hardware saved part ... R0-R3, R12, LR, PC, xPSR */
+    Stack_Ptr[14] = (uint32)Os_TaskEntry;                    /* LR ... never used, Os_TaskEntry does not return */
+    Stack_Ptr[15] = (uint32)Os_TaskEntry & ~((uint32)1);     /* PC ... the Thumb bit is kept in the xPSR */
+    Stack_Ptr[16] = OS_INITIAL_XPSR;
+
+    return Stack_Ptr;
+}
+#endif
+
+/*********************************************************************************************/
+uint32 * Os_SwitchContext(uint32 * Stack_Pointer)
+{
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    uint8 next_task;
+    uint32 task_bit;
+
+    Disable_Exceptions();
+    g_Task_Stack_Ptr[g_Current_Task] = Stack_Pointer;
+
+#if (OS_TASK_INSTRUMENTATION == STD_ON)
+    /* Stop the cycles count of the task switched out, the count of the next task starts now */
+    if(g_Current_Task != OS_IDLE_TASK_ID)
+    {
+        g_Task_Run_Cycles[g_Current_Task] += DWT_GetCycleCount() - g_Switch_In_Cycles;
+    }
+    g_Switch_In_Cycles = DWT_GetCycleCount();
+#endif
+
+    /* The highest priority ready task ... or the idle task */
+    next_task = OS_IDLE_TASK_ID;
+    for(task_bit = 0; task_bit < OS_NUMBER_OF_TASKS; task_bit++)
+    {
+        if(g_Ready_Mask & ((uint32)1 << task_bit))
+        {
+            next_task = (uint8)task_bit;
+            break;
+        }
+    }
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+    if((next_task != OS_IDLE_TASK_ID) && ((g_Started_Mask & ((uint32)1 << next_task)) == 0))
+    {
+        g_Task_Stack_Ptr[next_task] = Os_InitTaskStack(next_task);
+        g_Started_Mask |= ((uint32)1 << next_task);
+    }
+
+    g_Current_Task = next_task;
+    Stack_Pointer  = g_Task_Stack_Ptr[next_task];
+    Enable_Exceptions();
+#endif
+    /* In the cooperative mode PendSV is never triggered ... nothing to switch */
+    return Stack_Pointer;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetDeadlineMisses(uint8 TaskId)
+{
+    uint32 misses = 0;
+
+    if(TaskId < OS_NUMBER_OF_TASKS)
+    {
+        misses = g_Task_Deadline_Misses[TaskId];
+    }
+    return misses;
+}
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_REPORT)
+/*********************************************************************************************/
+void Os_SetOverrunCallBack(void (*Ptr2Func)(uint8 TaskId))
+{
+    g_Overrun_Call_Back_Ptr = Ptr2Func;
+}
+#endif
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    /* Keep the interrupts disabled until the idle task runs on its own stack */
+    Disable_Exceptions();
+#else
     /* Global Interrupts Enable */
     Enable_Exceptions();
+#endif
     
+    /* Prepare the released tasks of each tick before the first tick */
+    Os_BuildSchedule();
+
+#if (OS_TASK_INSTRUMENTATION == STD_ON)
+    /* Start the cycle counter used to measure the tasks */
+    Os_InstrumentationInit();
+#endif
+
     /* 
      * Set the Call Back function to call Os_NewTimerTick
      * this function will be called every SysTick Interrupt (20ms)
@@ -47,60 +590,163 @@ void Os_start(void)
 
     /* Start SysTickTimer to generate interrupt every 20ms */
     SysTick_Start(OS_BASE_TIME);
+    g_Tick_Cycles = SysTick_GetReloadValue() + 1;
 
     /* Execute the Init Task */
     Init_Task();
 
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    /* Assign the lowest priority to PendSV */
+    REG_WRITE(NVIC_SYSTEM_PRI3_REG_ADDRESS, (REG_READ(NVIC_SYSTEM_PRI3_REG_ADDRESS) & OS_PENDSV_PRIORITY_MASK) | (OS_PENDSV_PRIORITY << OS_PENDSV_PRIORITY_BITS_POS));
+
+    /* Start the Os Scheduler as the idle task on its own stack, the interrupts are enabled there */
+    Os_PortStartIdle((uint32 *)&g_Task_Stack[OS_IDLE_TASK_ID][OS_TASK_STACK_SIZE / 8], Os_Scheduler);
+#else
     /* Start the Os Scheduler */
     Os_Scheduler();
+#endif
 }
 
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
+#if (OS_TICKLESS_MODE == STD_ON)
+    uint32 next_release_tick;
+
+    /* Increment the Os time by the ticks of the SysTick period that just ended */
+    g_Time_Tick_Count  += g_Running_Period_Ticks;
+    g_Hyperperiod_Tick += g_Running_Period_Ticks;
+
+    /* The scheduler handles each tick of the ended SysTick period, only the last one releases tasks */
+    g_Pending_Ticks    += g_Running_Period_Ticks;
+#else
+    /* Increment the Os time by one tick (OS_BASE_TIME) */
+    g_Time_Tick_Count++;
+
+    /* Move to the next tick of the hyperperiod */
+    g_Hyperperiod_Tick++;
+
+    /* Increment the number of ticks waiting for the scheduler */
+    g_Pending_Ticks++;
+#endif
+    if(g_Hyperperiod_Tick >= OS_HYPERPERIOD_TICKS)
+    {
+        g_Hyperperiod_Tick -= OS_HYPERPERIOD_TICKS;
+
+#if (OS_LOW_POWER_IDLE == STD_ON)
+        /* Keep the idle time of the completed hyperperiod and start counting again */
+        g_Last_Hyperperiod_Idle_Cycles = g_Idle_Cycles;
+        g_Idle_Cycles = 0;
+#endif
+
+#if (OS_TASK_INSTRUMENTATION == STD_ON)
+        /* Keep the busy time of the completed hyperperiod and start counting again */
+        g_Last_Hyperperiod_Busy_Cycles = g_Busy_Cycles;
+        g_Busy_Cycles = 0;
+#endif
+    }
+
+#if (OS_TICKLESS_MODE == STD_ON)
+    /*
+     * The SysTick already reloaded the period programmed at the previous interrupt and keeps counting,
+     * so the period after it is programmed now ... the Os time only moves by whole periods and never drifts
+     */
+    g_Running_Period_Ticks = g_Reload_Period_Ticks;
+
+    next_release_tick = g_Hyperperiod_Tick + g_Running_Period_Ticks;
+    if(next_release_tick >= OS_HYPERPERIOD_TICKS)
+    {
+        next_release_tick -= OS_HYPERPERIOD_TICKS;
+    }
+
+    g_Reload_Period_Ticks = g_Next_Release_Ticks[next_release_tick];
+    if(g_Reload_Period_Ticks > OS_TICKLESS_MAX_TICKS)
+    {
+        g_Reload_Period_Ticks = OS_TICKLESS_MAX_TICKS; /* wake up at an empty tick and program the rest later */
+    }
+    SysTick_SetReloadValue((g_Reload_Period_Ticks * g_Tick_Cycles) - 1);
+#endif
 
-    /* Set the flag to 1 to indicate that there is a new timer tick */
-    g_New_Time_Tick_Flag = 1;
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    /* Release the tasks now and preempt the running task in-case a higher priority task is ready */
+    Os_ActivateTasks();
+#endif
 }
 
 /*********************************************************************************************/
 void Os_Scheduler(void)
 {
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    /* The tasks are released by the timer interrupt and switched by PendSV ... this is the idle task */
     while(1)
     {
-	/* Code is only executed in case there is a new timer tick */
-	if(g_New_Time_Tick_Flag == 1)
-	{
-	    switch(g_Time_Tick_Count)
+#if (OS_LOW_POWER_IDLE == STD_ON)
+        Os_Idle();
+#endif
+    }
+#else
+    uint32 pending_ticks;
+    uint32 first_tick;
+    uint32 released_mask;
+    uint32 missed_mask;
+    uint32 tick;
+
+    while(1)
+    {
+        /* Take all the ticks that passed since the last check */
+        Disable_Exceptions();
+        pending_ticks   = g_Pending_Ticks;
+        g_Pending_Ticks = 0;
+        Enable_Exceptions();
+
+        /* Code is only executed in case there is a new timer tick */
+        if(pending_ticks != 0)
+        {
+            /* A task released again before its previous release was executed missed a release */
+            first_tick    = g_Release_Tick;
+            released_mask = 0;
+            missed_mask   = 0;
+            for(tick = 0; tick < pending_ticks; tick++)
+            {
+                g_Release_Tick++;
+                if(g_Release_Tick == OS_HYPERPERIOD_TICKS)
+                {
+                    g_Release_Tick = 0;
+                }
+                missed_mask    = released_mask & g_Tick_Task_Mask[g_Release_Tick];
+                released_mask |= g_Tick_Task_Mask[g_Release_Tick];
+
+                if(missed_mask != 0)
+                {
+                    Os_CountMisses(missed_mask);
+                }
+            }
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_CATCH_UP)
+            /* Execute the releases of each tick in order */
+            for(tick = 0; tick < pending_ticks; tick++)
             {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
+                first_tick++;
+                if(first_tick == OS_HYPERPERIOD_TICKS)
+                {
+                    first_tick = 0;
+                }
+                Os_RunTasks(g_Tick_Task_Mask[first_tick]);
             }
-	}
+#else
+            /* Execute each released task once */
+            Os_RunTasks(released_mask);
+#endif
+        }
+#if (OS_LOW_POWER_IDLE == STD_ON)
+        else
+        {
+            /* No task is ready ... sleep until the next interrupt */
+            Os_Idle();
+        }
+#endif
     }
 
+#endif
 }
 /*********************************************************************************************/
@@ -13,9 +13,19 @@
 #define OS_H_
 
 #include "Std_Types.h"
+#include "Os_Cfg.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Description: Structure to configure each task in the Os task table
+ *  1. the task function
+ *  2. the task period in ms
+ *  3. the time of the first release in ms
+ */
+typedef struct
+{
+    void (*Task_Ptr)(void);
+    uint32 Period;
+    uint32 Offset;
+}Os_TaskConfigType;
 
 /* Description: 
  * Function responsible for:
@@ -32,4 +42,43 @@ void Os_Scheduler(void);
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+/* Description: Function to get the number of times the task number TaskId in the task table was released
+ * again before its previous release was executed */
+uint32 Os_GetDeadlineMisses(uint8 TaskId);
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_REPORT)
+/* Description: Function to setup the call back called with the ID of each task that missed a release */
+void Os_SetOverrunCallBack(void (*Ptr2Func)(uint8 TaskId));
+#endif
+
+#if (OS_LOW_POWER_IDLE == STD_ON)
+/* Description: Function to get the percentage of time spent in the low power idle during the last hyperperiod, 0 before Os_start */
+uint8 Os_GetIdlePercentage(void);
+#endif
+
+#if (OS_TASK_INSTRUMENTATION == STD_ON)
+/* Description: Structure to hold the execution time statistics of one task in clock cycles
+ *  1. the shortest, longest and average execution time
+ *  2. the number of runs
+ *  3. the number of runs that did not finish before the next tick
+ */
+typedef struct
+{
+    uint32 Min_Cycles;
+    uint32 Max_Cycles;
+    uint32 Average_Cycles;
+    uint32 Runs;
+    uint32 Overruns;
+}Os_TaskStatsType;
+
+/* Description: Function to get the execution time statistics of the task number TaskId in the task table */
+Std_ReturnType Os_GetTaskStats(uint8 TaskId, Os_TaskStatsType * Stats);
+
+/* Description: Function to get the percentage of time spent in the tasks during the last hyperperiod, 0 before Os_start */
+uint8 Os_GetCpuLoad(void);
+#endif
+
+/* Extern task table to be used by the Os Scheduler */
+extern const Os_TaskConfigType Os_TaskTable[OS_NUMBER_OF_TASKS];
+
 #endif /* OS_H_ */
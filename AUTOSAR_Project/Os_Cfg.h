@@ -0,0 +1,112 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Os Scheduler
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* SysTick clock and Reload register limit used by the tickless mode */
+#include "Gpt.h"
+
+/* Timer counting time in ms */
+#define OS_BASE_TIME                    (20U)
+
+/* Enter the low power mode (WFI) while waiting for the next tick instead of polling */
+#define OS_LOW_POWER_IDLE               (STD_OFF)
+
+/*
+ * Program the SysTick to interrupt at the next task release instead of every OS_BASE_TIME,
+ * useful when most of the ticks release no task
+ */
+#define OS_TICKLESS_MODE                (STD_OFF)
+
+/* Longest SysTick period in ticks ... limited by the 24-bit SysTick Reload register (Gpt.h) */
+#define OS_TICKLESS_MAX_TICKS           ((GPT_SYSTICK_MAX_RELOAD_VALUE + 1U) / (GPT_SYSTEM_CLOCK_CYCLES_PER_MS * OS_BASE_TIME))
+
+/* Measure the execution time of each task and the CPU load with the DWT cycle counter */
+#define OS_TASK_INSTRUMENTATION         (STD_OFF)
+
+/* What the scheduler does with the task releases of the ticks that passed while the tasks were still running */
+#define OS_OVERRUN_CATCH_UP             (0U)    /* execute all the missed releases late, in order */
+#define OS_OVERRUN_SKIP                 (1U)    /* execute each released task once and drop its repeated releases */
+#define OS_OVERRUN_REPORT               (2U)    /* as OS_OVERRUN_SKIP and report each task that missed a release */
+
+#define OS_OVERRUN_POLICY               (OS_OVERRUN_CATCH_UP)
+
+/*
+ * Run the tasks preemptively by priority using PendSV for the context switch (Os_Port.asm),
+ * the first task in the task table has the highest priority
+ */
+#define OS_PREEMPTIVE_MODE              (STD_OFF)
+
+/* Stack size in bytes of each task and of the idle task in the preemptive mode */
+#define OS_TASK_STACK_SIZE              (512U)
+
+/* Number of tasks in the Os task table */
+#define OS_NUMBER_OF_TASKS              (3U)
+
+/* Period and first release offset of each task in ms */
+#define OS_BUTTON_TASK_PERIOD           (20U)
+#define OS_BUTTON_TASK_OFFSET           (0U)
+
+#define OS_APP_TASK_PERIOD              (60U)
+#define OS_APP_TASK_OFFSET              (0U)
+
+#define OS_LED_TASK_PERIOD              (40U)
+#define OS_LED_TASK_OFFSET              (0U)
+
+/* Least common multiple of all the task periods ... the schedule repeats every hyperperiod */
+#define OS_HYPERPERIOD                  (120U)
+
+/* Number of timer ticks in one hyperperiod */
+#define OS_HYPERPERIOD_TICKS            (OS_HYPERPERIOD / OS_BASE_TIME)
+
+/* The released tasks of each tick are stored as one bit per task */
+#if (OS_NUMBER_OF_TASKS > 32U)
+  #error "The Os supports up to 32 tasks"
+#endif
+
+#if ((OS_PREEMPTIVE_MODE == STD_ON) && (OS_NUMBER_OF_TASKS > 31U))
+  #error "The preemptive Os supports up to 31 tasks"
+#endif
+
+#if ((OS_TASK_STACK_SIZE % 8U) != 0U)
+  #error "OS_TASK_STACK_SIZE has to be a multiple of 8 bytes"
+#endif
+
+#if ((OS_TICKLESS_MODE == STD_ON) && (OS_TICKLESS_MAX_TICKS == 0U))
+  #error "OS_BASE_TIME is too long for the SysTick Timer"
+#endif
+
+#if ((OS_OVERRUN_POLICY != OS_OVERRUN_CATCH_UP) && (OS_OVERRUN_POLICY != OS_OVERRUN_SKIP) && (OS_OVERRUN_POLICY != OS_OVERRUN_REPORT))
+  #error "Invalid OS_OVERRUN_POLICY"
+#endif
+
+#if ((OS_HYPERPERIOD % OS_BASE_TIME) != 0U)
+  #error "OS_HYPERPERIOD has to be a multiple of OS_BASE_TIME"
+#endif
+
+/* Each task is released on a tick and repeats an integer number of times in the hyperperiod */
+#if ((OS_BUTTON_TASK_PERIOD == 0U) || ((OS_BUTTON_TASK_PERIOD % OS_BASE_TIME) != 0U) || ((OS_BUTTON_TASK_OFFSET % OS_BASE_TIME) != 0U) || \
+     ((OS_HYPERPERIOD % OS_BUTTON_TASK_PERIOD) != 0U) || (OS_BUTTON_TASK_OFFSET >= OS_BUTTON_TASK_PERIOD))
+  #error "Invalid Button Task period or offset"
+#endif
+
+#if ((OS_APP_TASK_PERIOD == 0U) || ((OS_APP_TASK_PERIOD % OS_BASE_TIME) != 0U) || ((OS_APP_TASK_OFFSET % OS_BASE_TIME) != 0U) || \
+     ((OS_HYPERPERIOD % OS_APP_TASK_PERIOD) != 0U) || (OS_APP_TASK_OFFSET >= OS_APP_TASK_PERIOD))
+  #error "Invalid App Task period or offset"
+#endif
+
+#if ((OS_LED_TASK_PERIOD == 0U) || ((OS_LED_TASK_PERIOD % OS_BASE_TIME) != 0U) || ((OS_LED_TASK_OFFSET % OS_BASE_TIME) != 0U) || \
+     ((OS_HYPERPERIOD % OS_LED_TASK_PERIOD) != 0U) || (OS_LED_TASK_OFFSET >= OS_LED_TASK_PERIOD))
+  #error "Invalid Led Task period or offset"
+#endif
+
+#endif /* OS_CFG_H_ */
@@ -0,0 +1,24 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Configuration Source file for Os Scheduler - task table
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/*
+ * Task table ... the tasks released in the same tick are executed in the table order
+ * A task is released every Period ms starting from Offset ms, time 0 is never released
+ */
+const Os_TaskConfigType Os_TaskTable[OS_NUMBER_OF_TASKS] =
+{
+    {Button_Task, OS_BUTTON_TASK_PERIOD, OS_BUTTON_TASK_OFFSET},
+    {App_Task,    OS_APP_TASK_PERIOD,    OS_APP_TASK_OFFSET},
+    {Led_Task,    OS_LED_TASK_PERIOD,    OS_LED_TASK_OFFSET}
+};
@@ -0,0 +1,66 @@
+;******************************************************************************
+;
+; Module: Os
+;
+; File Name: Os_Port.asm
+;
+; Description: Context switch of the preemptive Os for the ARM Cortex-M4F (TI assembler syntax).
+;              Only used when OS_PREEMPTIVE_MODE is STD_ON.
+;
+; Author: Mohamed Tarek
+;******************************************************************************
+
+        .thumb
+        .text
+
+        .global PendSV_Handler
+        .global Os_PortStartIdle
+        .ref    Os_SwitchContext
+
+;******************************************************************************
+; Service Name: PendSV_Handler
+; Description: Save the context of the running task on its stack (PSP), ask
+;              Os_SwitchContext for the next task and restore its context:
+;              - R0-R3, R12, LR, PC and xPSR are saved and restored by the HW
+;              - R4-R11 and EXC_RETURN are saved and restored here
+;              - S16-S31 are saved only in-case the task used the FPU (EXC_RETURN bit 4 = 0),
+;                S0-S15 and FPSCR are then part of the HW frame
+;******************************************************************************
+PendSV_Handler: .asmfunc
+        MRS       R0, PSP
+        TST       LR, #0x10
+        IT        EQ
+        VSTMDBEQ  R0!, {S16-S31}
+        STMDB     R0!, {R4-R11, LR}
+
+        BL        Os_SwitchContext          ; R0 = stack pointer of the next task
+
+        LDMIA     R0!, {R4-R11, LR}
+        TST       LR, #0x10
+        IT        EQ
+        VLDMIAEQ  R0!, {S16-S31}
+        MSR       PSP, R0
+        BX        LR
+        .endasmfunc
+
+;******************************************************************************
+; Service Name: Os_PortStartIdle
+; Parameters (in): R0 - Top of the idle task stack
+;                  R1 - Idle task function
+; Description: Move the Thread mode to the idle task stack (PSP), give the whole
+;              main stack back to the exceptions (MSP), enable the interrupts
+;              and jump to the idle task. This function never returns.
+;******************************************************************************
+Os_PortStartIdle: .asmfunc
+        MSR       PSP, R0
+        MOVS      R0, #2                    ; SPSEL = 1 ... Thread mode uses the PSP
+        MSR       CONTROL, R0
+        ISB
+        MOVS      R0, #0                    ; the initial main stack pointer is the first entry of the vector table
+        LDR       R0, [R0]
+        MSR       MSP, R0
+        CPSIE     I
+        BX        R1
+        .endasmfunc
+
+        .end
@@ -8,6 +8,7 @@
 #include "Port.h"
 #include "Port_Regs.h"
 #include "tm4c123gh6pm_registers.h"
+#include "Reg_Access.h"
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -21,162 +22,1284 @@
 
 #endif
 
+/* Base address of each port indexed by the port ID */
+STATIC const uint32 Port_BaseAddress[PORT_NUMBER_OF_PORTS] =
+{
+    GPIO_PORTA_BASE_ADDRESS, /* PORTA Base Address */
+    GPIO_PORTB_BASE_ADDRESS, /* PORTB Base Address */
+    GPIO_PORTC_BASE_ADDRESS, /* PORTC Base Address */
+    GPIO_PORTD_BASE_ADDRESS, /* PORTD Base Address */
+    GPIO_PORTE_BASE_ADDRESS, /* PORTE Base Address */
+    GPIO_PORTF_BASE_ADDRESS  /* PORTF Base Address */
+};
+
 STATIC const Port_ConfigPin *Port_configPtr = NULL_PTR;
+STATIC const Port_PortImageType *Port_imagePtr = NULL_PTR;
 STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 
+#if (PORT_VARIANT_API == STD_ON)
+/* Variant ID of the configuration currently applied to the ports */
+STATIC uint8 Port_CurrentVariant = PORT_VARIANT_NORMAL;
+#endif
+
+/* Pins of each port found with a wrong direction at the last refresh */
+STATIC uint8 Port_DirectionDrift[PORT_NUMBER_OF_PORTS] = {0U};
+
+/* Pins of each port which are locked at reset indexed by the port ID */
+STATIC const uint8 Port_LockedPins[PORT_NUMBER_OF_PORTS] =
+{
+    0x00,                       /* PORTA */
+    0x00,                       /* PORTB */
+    PORT_PORTC_LOCKED_PINS,     /* PORTC */
+    PORT_PORTD_LOCKED_PINS,     /* PORTD */
+    0x00,                       /* PORTE */
+    PORT_PORTF_LOCKED_PINS      /* PORTF */
+};
+
+/* GPIOPCTL value of each mode for the 8 pins of each port indexed by the port ID and the mode */
+#define PORT_PCTL_MODES(PORT) \
+    { \
+        PORT_PCTL_MODE(PORT, PORT_PIN_MODE_ADC),     PORT_PCTL_MODE(PORT, PORT_PIN_MODE_CAN), \
+        PORT_PCTL_MODE(PORT, PORT_PIN_MODE_DIO),     PORT_PCTL_MODE(PORT, PORT_PIN_MODE_DIO_GPT), \
+        PORT_PCTL_MODE(PORT, PORT_PIN_MODE_DIO_WDG), PORT_PCTL_MODE(PORT, PORT_PIN_MODE_FLEXRAY), \
+        PORT_PCTL_MODE(PORT, PORT_PIN_MODE_ICU),     PORT_PCTL_MODE(PORT, PORT_PIN_MODE_LIN), \
+        PORT_PCTL_MODE(PORT, PORT_PIN_MODE_MEM),     PORT_PCTL_MODE(PORT, PORT_PIN_MODE_PWM), \
+        PORT_PCTL_MODE(PORT, PORT_PIN_MODE_SPI) \
+    }
+
+STATIC const uint32 Port_PctlTable[PORT_NUMBER_OF_PORTS][PORT_PIN_MODE_SPI + 1] =
+{
+    PORT_PCTL_MODES(PORT_PORTA_ID),
+    PORT_PCTL_MODES(PORT_PORTB_ID),
+    PORT_PCTL_MODES(PORT_PORTC_ID),
+    PORT_PCTL_MODES(PORT_PORTD_ID),
+    PORT_PCTL_MODES(PORT_PORTE_ID),
+    PORT_PCTL_MODES(PORT_PORTF_ID)
+};
+
+/* NVIC interrupt number of each port indexed by the port ID */
+STATIC const uint8 Port_IrqNumber[PORT_NUMBER_OF_PORTS] = {0U, 1U, 2U, 3U, 4U, 30U};
+
+/* Call back of each edge interrupt pin indexed by the port ID and the pin number */
+STATIC void (*Port_Edge_Call_Back_Ptr[PORT_NUMBER_OF_PORTS][PORT_PIN7_ID + 1U])(void);
+
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+/* Expected register image of each port ... the configured images updated by the runtime APIs */
+STATIC Port_PortImageType Port_ExpectedImage[PORT_NUMBER_OF_PORTS];
+
+/* GPIOPCTL bits of the configured pins of each port */
+STATIC uint32 Port_PctlPinsMask[PORT_NUMBER_OF_PORTS];
+
+STATIC void (*Port_Repair_Call_Back_Ptr)(uint8 PortId, uint8 RepairedRegisters) = NULL_PTR;
+#endif
+
+/************************************************************************************
+ * Function Name: Port_WriteRegister
+ * Description: Write a value into one of the port registers using a single store.
+ *              In-case some pins of the port are not owned by the configuration
+ *              (Keep_Mask != 0) their bits are read back and preserved.
+ ************************************************************************************/
+STATIC void Port_WriteRegister(uint32 Port_Base_Address, uint32 Reg_Offset, uint32 Keep_Mask, uint32 Value)
+{
+    uint32 Reg_Address = Port_Base_Address + Reg_Offset;
+
+    if(0U == Keep_Mask)
+    {
+        REG_WRITE(Reg_Address, Value);                                     /* The whole port is owned by the configuration ... no need to read the register */
+    }
+    else
+    {
+        REG_WRITE(Reg_Address, (REG_READ(Reg_Address) & Keep_Mask) | Value); /* Preserve the bits of the pins that are not configured */
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_PinMaskToPctlMask
+ * Description: Expand a pins mask to the corresponding PMCx nibbles mask of the GPIOPCTL register.
+ ************************************************************************************/
+STATIC uint32 Port_PinMaskToPctlMask(uint8 Pin_Mask)
+{
+    uint32 pctl_mask = 0U;
+    uint8 pin;
+
+    for(pin = PORT_PIN0_ID; pin <= PORT_PIN7_ID; pin++)
+    {
+        if(BIT_IS_SET(Pin_Mask, pin))
+        {
+            pctl_mask |= ((uint32)0x0000000F << (pin * 4));
+        }
+    }
+    return pctl_mask;
+}
+
+#if ((PORT_SET_PIN_MODE_API == STD_ON) && (PORT_DEV_ERROR_DETECT == STD_ON))
+/************************************************************************************
+ * Function Name: Port_IsModeAvailable
+ * Description: Check if a mode can be used on one pin using the GPIOPCTL table.
+ ************************************************************************************/
+STATIC boolean Port_IsModeAvailable(uint8 PortId, uint8 PinNum, Port_PinModeType Mode)
+{
+    boolean available = FALSE;
+
+    if(PORT_PIN_MODE_SPI < Mode)
+    {
+        /* Do Nothing ... Invalid mode */
+    }
+    else if(PORT_PIN_MODE_DIO == Mode)
+    {
+        available = TRUE;
+    }
+    else if(PORT_PIN_MODE_ADC == Mode)
+    {
+        available = BIT_IS_SET(PORT_ANALOG_PINS(PortId), PinNum) ? TRUE : FALSE;
+    }
+    else
+    {
+        /* The PMCx nibble of the pin is zero in-case the mode has no signal on this pin */
+        available = (0U != ((Port_PctlTable[PortId][Mode] >> (PinNum * 4)) & 0x0000000FU)) ? TRUE : FALSE;
+    }
+    return available;
+}
+#endif
+
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_SetExpectedBits
+ * Description: Update the Mask bits of one register in the expected port image.
+ ************************************************************************************/
+STATIC void Port_SetExpectedBits(uint32 * Image_Reg_Ptr, uint32 Mask, uint32 Value)
+{
+    *Image_Reg_Ptr = (*Image_Reg_Ptr & ~Mask) | Value;
+}
+
+/************************************************************************************
+ * Function Name: Port_RepairRegister
+ * Description: Read one port register once and compare the Check_Mask bits with the
+ *              expected value, the drifted bits only are flipped back with one write.
+ *              Returns 1 in-case the register was repaired and 0 otherwise.
+ ************************************************************************************/
+STATIC uint8 Port_RepairRegister(uint32 Port_Base_Address, uint32 Reg_Offset, uint32 Expected, uint32 Check_Mask)
+{
+    uint32 Reg_Address = Port_Base_Address + Reg_Offset;
+    uint32 value = REG_READ(Reg_Address);
+    uint32 drift = (value ^ Expected) & Check_Mask;
+    uint8 repaired = 0U;
+
+    if(0U != drift)
+    {
+        REG_WRITE(Reg_Address, value ^ drift);
+        repaired = 1U;
+    }
+    else
+    {
+        /* The register is as expected ... no write is needed */
+    }
+    return repaired;
+}
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_WritePinsMode
+ * Description: Compose the GPIOAMSEL, GPIOAFSEL, GPIOPCTL and GPIODEN bits of all the
+ *              pins set in Pins_Mask for the required mode and write each register once.
+ *              The PMCx nibbles of the pins are taken from the GPIOPCTL table with one lookup.
+ ************************************************************************************/
+STATIC void Port_WritePinsMode(uint8 PortId, uint8 Pins_Mask, Port_PinModeType Mode)
+{
+    uint32 Port_Base_Address = Port_BaseAddress[PortId]; /* Port Base Address */
+    uint32 keep_mask = (uint32)((uint8)(~Pins_Mask));
+    uint32 pctl_mask = Port_PinMaskToPctlMask(Pins_Mask);
+    uint32 amsel     = (Mode == PORT_PIN_MODE_ADC) ? (uint32)Pins_Mask : 0U;                                    /* Analog functionality for ADC mode only */
+    uint32 afsel     = ((Mode != PORT_PIN_MODE_DIO) && (Mode != PORT_PIN_MODE_ADC)) ? (uint32)Pins_Mask : 0U;  /* Alternative function for peripheral modes */
+    uint32 pctl      = Port_PctlTable[PortId][Mode] & pctl_mask;                                               /* PMCx bits of the mode, zero for DIO and ADC */
+    uint32 den       = (Mode != PORT_PIN_MODE_ADC) ? (uint32)Pins_Mask : 0U;                                    /* Digital functionality for all modes except ADC */
+
+    Port_WriteRegister(Port_Base_Address, PORT_ANALOG_MODE_SEL_REG_OFFSET, keep_mask, amsel);   /* GPIOAMSEL */
+    Port_WriteRegister(Port_Base_Address, PORT_ALT_FUNC_REG_OFFSET, keep_mask, afsel);          /* GPIOAFSEL */
+    Port_WriteRegister(Port_Base_Address, PORT_CTL_REG_OFFSET, ~pctl_mask, pctl);               /* GPIOPCTL */
+    Port_WriteRegister(Port_Base_Address, PORT_DIGITAL_ENABLE_REG_OFFSET, keep_mask, den);      /* GPIODEN */
+
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+    /* Keep the expected image in sync with the new mode */
+    Port_SetExpectedBits(&Port_ExpectedImage[PortId].amsel, (uint32)Pins_Mask, amsel);
+    Port_SetExpectedBits(&Port_ExpectedImage[PortId].afsel, (uint32)Pins_Mask, afsel);
+    Port_SetExpectedBits(&Port_ExpectedImage[PortId].pctl, pctl_mask, pctl);
+    Port_SetExpectedBits(&Port_ExpectedImage[PortId].den, (uint32)Pins_Mask, den);
+#endif
+}
+#endif
+
+#if (PORT_IMAGE_SELF_CHECK == STD_ON)
+/************************************************************************************
+ * Function Name: Port_BuildPortImages
+ * Description: Aggregate the configuration of all the configured pins into one
+ *              register image per port, no registers are accessed here.
+ ************************************************************************************/
+STATIC void Port_BuildPortImages(const Port_ConfigPin * Pins, Port_PortImageType * Images)
+{
+    Port_PortImageType * Image_Ptr = NULL_PTR;
+    uint32 pin_bit;
+    uint8 portIndex;
+    uint8 pinIndex;
+
+    for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
+    {
+        Images[portIndex].pin_mask    = 0U;
+        Images[portIndex].commit_mask = 0U;
+        Images[portIndex].refresh_mask = 0U;
+        Images[portIndex].dir         = 0U;
+        Images[portIndex].data        = 0U;
+        Images[portIndex].pur         = 0U;
+        Images[portIndex].pdr         = 0U;
+        Images[portIndex].amsel       = 0U;
+        Images[portIndex].afsel       = 0U;
+        Images[portIndex].pctl        = 0U;
+        Images[portIndex].den         = 0U;
+        Images[portIndex].is          = 0U;
+        Images[portIndex].ibe         = 0U;
+        Images[portIndex].iev         = 0U;
+        Images[portIndex].im          = 0U;
+    }
+
+    for(pinIndex = PORT_PIN0_ID; pinIndex < PORT_CONFIGURED_PINS; pinIndex++)
+    {
+        if( (PORT_PIN_CFG_PORT_NUM(Pins[pinIndex]) == PORT_PORTC_ID) && (PORT_PIN_CFG_PIN_NUM(Pins[pinIndex]) <= PORT_PIN3_ID) ) /* PC0 to PC3 */
+        {
+            /* Do Nothing ...  this is the JTAG pins */
+            continue;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+
+        Image_Ptr = &Images[PORT_PIN_CFG_PORT_NUM(Pins[pinIndex])];
+        pin_bit   = ((uint32)1 << PORT_PIN_CFG_PIN_NUM(Pins[pinIndex]));
+
+        Image_Ptr->pin_mask |= (uint8)pin_bit;
+
+        if( ((PORT_PIN_CFG_PORT_NUM(Pins[pinIndex]) == PORT_PORTD_ID) && (PORT_PIN_CFG_PIN_NUM(Pins[pinIndex]) == PORT_PIN7_ID)) || \
+                ((PORT_PIN_CFG_PORT_NUM(Pins[pinIndex]) == PORT_PORTF_ID) && (PORT_PIN_CFG_PIN_NUM(Pins[pinIndex]) == PORT_PIN0_ID)) ) /* PD7 or PF0 */
+        {
+            Image_Ptr->commit_mask |= (uint8)pin_bit;   /* This pin is locked and the port has to be unlocked first */
+        }
+        else
+        {
+            /* Do Nothing ... No need to unlock the commit register for this pin */
+        }
+
+        if(PORT_PIN_CFG_DIRECTION_CHANGEABLE(Pins[pinIndex]) == PORT_PIN_DIRECTION_CHANGEABLE)
+        {
+            Image_Ptr->refresh_mask |= (uint8)pin_bit;  /* The direction of this pin is refreshed */
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Pin Direction, initial value for o/p pins and internal resistor for i/p pins */
+        if(PORT_PIN_CFG_DIRECTION(Pins[pinIndex]) == PORT_PIN_OUT)
+        {
+            Image_Ptr->dir |= pin_bit;
+
+            if(PORT_PIN_CFG_INITIAL_VALUE(Pins[pinIndex]) == STD_HIGH)
+            {
+                Image_Ptr->data |= pin_bit;
+            }
+            else
+            {
+                /* Initial value 0 */
+            }
+        }
+        else
+        {
+            if(PORT_PIN_CFG_RESISTOR(Pins[pinIndex]) == PULL_UP)
+            {
+                Image_Ptr->pur |= pin_bit;
+            }
+            else if(PORT_PIN_CFG_RESISTOR(Pins[pinIndex]) == PULL_DOWN)
+            {
+                Image_Ptr->pdr |= pin_bit;
+            }
+            else
+            {
+                /* Internal resistor disabled */
+            }
+        }
+
+        /* Pin Mode */
+        if(PORT_PIN_CFG_MODE(Pins[pinIndex]) == PORT_PIN_MODE_DIO) /* DIO Mode */
+        {
+            Image_Ptr->den |= pin_bit;
+        }
+        else if(PORT_PIN_CFG_MODE(Pins[pinIndex]) == PORT_PIN_MODE_ADC) /* ADC Mode */
+        {
+            Image_Ptr->amsel |= pin_bit;
+        }
+        else /* Any other Mode */
+        {
+            Image_Ptr->afsel |= pin_bit;
+            Image_Ptr->pctl  |= Port_PctlTable[PORT_PIN_CFG_PORT_NUM(Pins[pinIndex])][PORT_PIN_CFG_MODE(Pins[pinIndex])] & ((uint32)0x0000000F << (PORT_PIN_CFG_PIN_NUM(Pins[pinIndex]) * 4));
+            Image_Ptr->den   |= pin_bit;
+        }
+
+        /* Pin Edge Interrupt */
+        if(PORT_PIN_CFG_EDGE(Pins[pinIndex]) != PORT_PIN_EDGE_NONE)
+        {
+            Image_Ptr->im |= pin_bit;
+
+            if(PORT_PIN_CFG_EDGE(Pins[pinIndex]) == PORT_PIN_EDGE_BOTH)
+            {
+                Image_Ptr->ibe |= pin_bit;
+            }
+            else if(PORT_PIN_CFG_EDGE(Pins[pinIndex]) == PORT_PIN_EDGE_RISING)
+            {
+                Image_Ptr->iev |= pin_bit;
+            }
+            else
+            {
+                /* Falling edge */
+            }
+        }
+        else
+        {
+            /* No interrupt for this pin */
+        }
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_CheckPortImages
+ * Description: Decode the pins configuration the same way the per-pin initialization
+ *              used to and compare the result with the generated port images.
+ *              Returns E_NOT_OK in-case any register image does not match.
+ ************************************************************************************/
+STATIC Std_ReturnType Port_CheckPortImages(const Port_ConfigType * ConfigPtr)
+{
+    Port_PortImageType Port_Images[PORT_NUMBER_OF_PORTS];
+    Std_ReturnType result = E_OK;
+    uint8 portIndex;
+
+    Port_BuildPortImages(ConfigPtr->Pin, Port_Images);
+
+    for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
+    {
+        if( (Port_Images[portIndex].pin_mask    != ConfigPtr->Port[portIndex].pin_mask)    || \
+            (Port_Images[portIndex].commit_mask != ConfigPtr->Port[portIndex].commit_mask) || \
+            (Port_Images[portIndex].refresh_mask != ConfigPtr->Port[portIndex].refresh_mask) || \
+            (Port_Images[portIndex].dir         != ConfigPtr->Port[portIndex].dir)         || \
+            (Port_Images[portIndex].data        != ConfigPtr->Port[portIndex].data)        || \
+            (Port_Images[portIndex].pur         != ConfigPtr->Port[portIndex].pur)         || \
+            (Port_Images[portIndex].pdr         != ConfigPtr->Port[portIndex].pdr)         || \
+            (Port_Images[portIndex].amsel       != ConfigPtr->Port[portIndex].amsel)       || \
+            (Port_Images[portIndex].afsel       != ConfigPtr->Port[portIndex].afsel)       || \
+            (Port_Images[portIndex].pctl        != ConfigPtr->Port[portIndex].pctl)        || \
+            (Port_Images[portIndex].den         != ConfigPtr->Port[portIndex].den)         || \
+            (Port_Images[portIndex].is          != ConfigPtr->Port[portIndex].is)          || \
+            (Port_Images[portIndex].ibe         != ConfigPtr->Port[portIndex].ibe)         || \
+            (Port_Images[portIndex].iev         != ConfigPtr->Port[portIndex].iev)         || \
+            (Port_Images[portIndex].im          != ConfigPtr->Port[portIndex].im) )
+        {
+            result = E_NOT_OK;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    return result;
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_CommitPortImage
+ * Description: Write the Registers of the register image of one port into the hardware
+ *              with a single write per GPIO register.
+ *              In-case the port has configured locked pins, GPIOCR is unlocked once,
+ *              the whole commit value is written with one store and GPIOLOCK is
+ *              locked again after the last protected register (GPIODEN).
+ *              The edge interrupt pins are masked while their edges are configured,
+ *              the stale flags are cleared and then the pins are unmasked.
+ *              With PORT_IMAGE_REG_WHOLE the image holds whole register values and each
+ *              register is written without reading it first.
+ ************************************************************************************/
+STATIC void Port_CommitPortImage(uint8 PortId, const Port_PortImageType * Image, uint16 Registers)
+{
+    uint32 Port_Base_Address = Port_BaseAddress[PortId];  /* point to the required Port Registers base address */
+    uint32 keep_mask      = (0U != (Registers & PORT_IMAGE_REG_WHOLE)) ?
+                            0U : (uint32)((uint8)(~Image->pin_mask));   /* Pins of this port which are not configured */
+    uint32 pctl_keep_mask = Port_PinMaskToPctlMask((uint8)keep_mask);
+
+    if(0U != (Registers & PORT_IMAGE_REG_COMMIT))
+    {
+        REG_WRITE(Port_Base_Address + PORT_LOCK_REG_OFFSET, PORT_LOCK_KEY);                   /* Unlock the GPIOCR register */
+        REG_WRITE(Port_Base_Address + PORT_COMMIT_REG_OFFSET,
+                  (uint32)((uint8)(~Port_LockedPins[PortId]) | Image->commit_mask)); /* Commit the configured locked pins, the other pins keep their reset GPIOCR value */
+    }
+    else
+    {
+        /* Do Nothing ... No need to unlock the commit register for this port */
+    }
+
+    if(0U != (Registers & PORT_IMAGE_REG_DIR))
+    {
+        Port_WriteRegister(Port_Base_Address, PORT_DIR_REG_OFFSET, keep_mask, Image->dir);                    /* GPIODIR */
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_DATA))
+    {
+        REG_WRITE(Port_Base_Address + ((uint32)Image->pin_mask << 2), Image->data);  /* GPIODATA masked by the address bits ... only the configured pins are written */
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_PUR))
+    {
+        Port_WriteRegister(Port_Base_Address, PORT_PULL_UP_REG_OFFSET, keep_mask, Image->pur);                /* GPIOPUR */
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_PDR))
+    {
+        Port_WriteRegister(Port_Base_Address, PORT_PULL_DOWN_REG_OFFSET, keep_mask, Image->pdr);              /* GPIOPDR */
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_AMSEL))
+    {
+        Port_WriteRegister(Port_Base_Address, PORT_ANALOG_MODE_SEL_REG_OFFSET, keep_mask, Image->amsel);      /* GPIOAMSEL */
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_AFSEL))
+    {
+        Port_WriteRegister(Port_Base_Address, PORT_ALT_FUNC_REG_OFFSET, keep_mask, Image->afsel);             /* GPIOAFSEL */
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_PCTL))
+    {
+        Port_WriteRegister(Port_Base_Address, PORT_CTL_REG_OFFSET, pctl_keep_mask, Image->pctl);              /* GPIOPCTL */
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_DEN))
+    {
+        Port_WriteRegister(Port_Base_Address, PORT_DIGITAL_ENABLE_REG_OFFSET, keep_mask, Image->den);         /* GPIODEN */
+    }
+
+    if(0U != (Registers & PORT_IMAGE_REG_COMMIT))
+    {
+        REG_WRITE(Port_Base_Address + PORT_LOCK_REG_OFFSET, PORT_LOCK_RELOCK);               /* Lock the GPIOCR register again */
+    }
+    else
+    {
+        /* Do Nothing ... The port was not unlocked */
+    }
+
+    if(0U != (Registers & PORT_IMAGE_REG_INT))
+    {
+        Port_WriteRegister(Port_Base_Address, PORT_INT_MASK_REG_OFFSET, keep_mask, 0U);                       /* GPIOIM ... mask the pins while the edges are configured */
+        Port_WriteRegister(Port_Base_Address, PORT_INT_SENSE_REG_OFFSET, keep_mask, Image->is);               /* GPIOIS */
+        Port_WriteRegister(Port_Base_Address, PORT_INT_BOTH_EDGES_REG_OFFSET, keep_mask, Image->ibe);          /* GPIOIBE */
+        Port_WriteRegister(Port_Base_Address, PORT_INT_EVENT_REG_OFFSET, keep_mask, Image->iev);              /* GPIOIEV */
+
+        if(0U != Image->im)
+        {
+            REG_WRITE(Port_Base_Address + PORT_INT_CLEAR_REG_OFFSET, Image->im);    /* GPIOICR ... clear the edges detected during the configuration */
+            Port_WriteRegister(Port_Base_Address, PORT_INT_MASK_REG_OFFSET, keep_mask, Image->im);            /* GPIOIM */
+            REG_WRITE(NVIC_EN0_REG_ADDRESS, (uint32)1 << Port_IrqNumber[PortId]);                               /* Enable the port interrupt in the NVIC */
+        }
+        else
+        {
+            /* Do Nothing ... No edge interrupt pins in this port */
+        }
+    }
+    else
+    {
+        /* Do Nothing ... The edge interrupt registers are not written */
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_ImageRegisters
+ * Description: Registers written to apply a whole port image, the commit registers
+ *              and the edge interrupt registers are only written when the port uses them.
+ ************************************************************************************/
+STATIC uint16 Port_ImageRegisters(const Port_PortImageType * Image)
+{
+    uint16 registers = PORT_IMAGE_REG_ALL;
+
+    if(0U == Image->commit_mask)
+    {
+        registers &= (uint16)(~PORT_IMAGE_REG_COMMIT);
+    }
+    if(0U == Image->im)
+    {
+        registers &= (uint16)(~PORT_IMAGE_REG_INT);
+    }
+    return registers;
+}
+
+#if ((PORT_VARIANT_API == STD_ON) && (PORT_VERIFY_REPAIR_API == STD_ON))
+/************************************************************************************
+ * Function Name: Port_SetExpectedRegisters
+ * Description: Set the Registers of the expected image of one port to the values of Image.
+ ************************************************************************************/
+STATIC void Port_SetExpectedRegisters(uint8 PortId, const Port_PortImageType * Image, uint16 Registers)
+{
+    Port_PortImageType * Expected_Ptr = &Port_ExpectedImage[PortId];
+
+    if(0U != (Registers & PORT_IMAGE_REG_DIR))
+    {
+        Expected_Ptr->dir = Image->dir;
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_DATA))
+    {
+        Expected_Ptr->data = Image->data;
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_PUR))
+    {
+        Expected_Ptr->pur = Image->pur;
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_PDR))
+    {
+        Expected_Ptr->pdr = Image->pdr;
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_AMSEL))
+    {
+        Expected_Ptr->amsel = Image->amsel;
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_AFSEL))
+    {
+        Expected_Ptr->afsel = Image->afsel;
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_PCTL))
+    {
+        Expected_Ptr->pctl = Image->pctl;
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_DEN))
+    {
+        Expected_Ptr->den = Image->den;
+    }
+    if(0U != (Registers & PORT_IMAGE_REG_INT))
+    {
+        Expected_Ptr->is  = Image->is;
+        Expected_Ptr->ibe = Image->ibe;
+        Expected_Ptr->iev = Image->iev;
+        Expected_Ptr->im  = Image->im;
+    }
+    Expected_Ptr->refresh_mask = Image->refresh_mask;
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_EdgeHandler
+ * Description: Clear the edge flags of the port with a single write and call the
+ *              call back of each pin that detected an edge.
+ ************************************************************************************/
+STATIC void Port_EdgeHandler(uint8 PortId)
+{
+    uint32 Port_Base_Address = Port_BaseAddress[PortId];
+    uint32 flags = REG_READ(Port_Base_Address + PORT_MASKED_INT_STATUS_REG_OFFSET);
+    uint8 pinIndex;
+
+    REG_WRITE(Port_Base_Address + PORT_INT_CLEAR_REG_OFFSET, flags);   /* Clear the served edges */
+
+    for(pinIndex = PORT_PIN0_ID; 0U != flags; pinIndex++)
+    {
+        if( (0U != (flags & 1U)) && (NULL_PTR != Port_Edge_Call_Back_Ptr[PortId][pinIndex]) )
+        {
+            (*Port_Edge_Call_Back_Ptr[PortId][pinIndex])();
+        }
+        else
+        {
+            /* No edge on this pin or no call back */
+        }
+        flags >>= 1;
+    }
+}
+
+/************************************************************************************
+ * Service Name: Port_Init
+ * Service ID[hex]: 0x00
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): ConfigPtr - Pointer to post-build configuration data
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to initialize the Port Driver Module
+ ************************************************************************************/
+void Port_Init(const Port_ConfigType * ConfigPtr)
+{
+    uint8 portIndex = PORT_PORTA_ID;
+
+    /* Check for development error */
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if (NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+    }
+    else
+#endif
+#if (PORT_IMAGE_SELF_CHECK == STD_ON)
+    /* check if the generated port images match the pins configuration ... the module stays uninitialized if not */
+    if (E_NOT_OK == Port_CheckPortImages(ConfigPtr))
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+#endif
+    }
+    else
+#endif
+    {
+        /*
+         * Set the module state to initialized and point to the PB configuration structure using a global pointer.
+         * This global pointer is global to be used by other functions to read the PB configuration structures
+         */
+        Port_Status = PORT_INITIALIZED;
+        Port_configPtr = ConfigPtr->Pin; /* address of the first Pin structure --> Pin[0] */
+        Port_imagePtr = ConfigPtr->Port; /* address of the first Port image --> Port[0] */
+#if (PORT_VARIANT_API == STD_ON)
+        Port_CurrentVariant = ConfigPtr->VariantId;
+#endif
+
+        /* The pins are already decoded into one register image per port ... write each port once */
+        for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
+        {
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+            /* The configured image is the expected state of the port until a runtime API changes it */
+            Port_ExpectedImage[portIndex] = ConfigPtr->Port[portIndex];
+            Port_PctlPinsMask[portIndex]  = Port_PinMaskToPctlMask(ConfigPtr->Port[portIndex].pin_mask);
+#endif
+
+            if(0U == ConfigPtr->Port[portIndex].pin_mask)
+            {
+                /* No configured pins in this port */
+                continue;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+
+            Port_CommitPortImage(portIndex, &ConfigPtr->Port[portIndex], Port_ImageRegisters(&ConfigPtr->Port[portIndex]));
+        }
+    }
+}
+
+/************************************************************************************
+ * Service Name: Port_SetPinDirection
+ * Service ID[hex]: 0x01
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ *                  Direction - Port Pin Direction
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to set the port pin direction
+ ************************************************************************************/
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+void Port_SetPinDirection(Port_PinType Pin,Port_PinDirectionType Direction)
+{
+    uint32 Port_Base_Address = 0U;
+    boolean error = FALSE;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PORT_NOT_INITIALIZED == Port_Status)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_DIRECTION_SID, PORT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the pin ID is valid */
+    else if (PORT_CONFIGURED_PINS <= Pin)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
+        error = TRUE;
+    }
+    /* Checks if the pin direction is changeable */
+    else if (PORT_PIN_DIRECTION_NOT_CHANGEABLE == PORT_PIN_CFG_DIRECTION_CHANGEABLE(Port_configPtr[Pin]))
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        Port_Base_Address = Port_BaseAddress[PORT_PIN_CFG_PORT_NUM(Port_configPtr[Pin])]; /* Port Base Address */
+
+        /* Set Pin Direction */
+        if(PORT_PIN_OUT == Direction)
+        {
+            REG_WRITE(Port_Base_Address + PORT_DIR_REG_OFFSET,
+                      REG_READ(Port_Base_Address + PORT_DIR_REG_OFFSET) | ((uint32)1 << PORT_PIN_CFG_PIN_NUM(Port_configPtr[Pin])));    /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+        }
+        else if(PORT_PIN_IN == Direction)
+        {
+            REG_WRITE(Port_Base_Address + PORT_DIR_REG_OFFSET,
+                      REG_READ(Port_Base_Address + PORT_DIR_REG_OFFSET) & ~((uint32)1 << PORT_PIN_CFG_PIN_NUM(Port_configPtr[Pin]))); /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+        /* Keep the expected image in sync with the new direction */
+        Port_SetExpectedBits(&Port_ExpectedImage[PORT_PIN_CFG_PORT_NUM(Port_configPtr[Pin])].dir, ((uint32)1 << PORT_PIN_CFG_PIN_NUM(Port_configPtr[Pin])),
+                             (PORT_PIN_OUT == Direction) ? ((uint32)1 << PORT_PIN_CFG_PIN_NUM(Port_configPtr[Pin])) : 0U);
+#endif
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_SetPinDirectionBatch
+ * Service ID[hex]: 0x05
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pins - Array of Port Pin ID numbers
+ *                  NumberOfPins - Number of pins in the Pins array
+ *                  Direction - Port Pin Direction for all the pins
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to set the direction of several port pins, the pins are
+ *              grouped by port and each port GPIODIR register is written once.
+ *              Nothing is changed in-case any of the pins is invalid.
+ ************************************************************************************/
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+void Port_SetPinDirectionBatch(const Port_PinType * Pins, uint8 NumberOfPins, Port_PinDirectionType Direction)
+{
+    uint8 Port_Pins_Mask[PORT_NUMBER_OF_PORTS] = {0U}; /* pins to be changed in each port */
+    uint8 pinIndex;
+    uint8 portIndex;
+    boolean error = FALSE;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PORT_NOT_INITIALIZED == Port_Status)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_DIRECTION_BATCH_SID, PORT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the input pins pointer is not a NULL_PTR */
+    else if (NULL_PTR == Pins)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_DIRECTION_BATCH_SID, PORT_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    else
+    {
+        for(pinIndex = 0U; pinIndex < NumberOfPins; pinIndex++)
+        {
+            /* Check if the pin ID is valid */
+            if (PORT_CONFIGURED_PINS <= Pins[pinIndex])
+            {
+                Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                                PORT_SET_PIN_DIRECTION_BATCH_SID, PORT_E_PARAM_PIN);
+                error = TRUE;
+            }
+            /* Checks if the pin direction is changeable */
+            else if (PORT_PIN_DIRECTION_NOT_CHANGEABLE == PORT_PIN_CFG_DIRECTION_CHANGEABLE(Port_configPtr[Pins[pinIndex]]))
+            {
+                Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                                PORT_SET_PIN_DIRECTION_BATCH_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+                error = TRUE;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* Group the pins by port first */
+        for(pinIndex = 0U; pinIndex < NumberOfPins; pinIndex++)
+        {
+            SET_BIT(Port_Pins_Mask[PORT_PIN_CFG_PORT_NUM(Port_configPtr[Pins[pinIndex]])], PORT_PIN_CFG_PIN_NUM(Port_configPtr[Pins[pinIndex]]));
+        }
+
+        /* Then write the GPIODIR register of each affected port once */
+        for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
+        {
+            if(0U != Port_Pins_Mask[portIndex])
+            {
+                Port_WriteRegister(Port_BaseAddress[portIndex], PORT_DIR_REG_OFFSET,
+                                   (uint32)((uint8)(~Port_Pins_Mask[portIndex])),
+                                   (PORT_PIN_OUT == Direction) ? (uint32)Port_Pins_Mask[portIndex] : 0U);
+
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+                /* Keep the expected image in sync with the new direction */
+                Port_SetExpectedBits(&Port_ExpectedImage[portIndex].dir, (uint32)Port_Pins_Mask[portIndex],
+                                     (PORT_PIN_OUT == Direction) ? (uint32)Port_Pins_Mask[portIndex] : 0U);
+#endif
+            }
+            else
+            {
+                /* No pins to be changed in this port */
+            }
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_RefreshPortDirection
+ * Service ID[hex]: 0x02
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to refresh port direction
+ ************************************************************************************/
+void Port_RefreshPortDirection(void)
+{
+    uint32 Port_Base_Address = 0U;
+    uint8 portIndex;
+    uint32 dir;
+    uint32 drift;
+    boolean error = FALSE;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PORT_NOT_INITIALIZED == Port_Status)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_REFRESH_PORT_DIRECTION_SID, PORT_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
+        {
+            if(0U == Port_imagePtr[portIndex].refresh_mask)
+            {
+                /* No pins to be refreshed in this port */
+                Port_DirectionDrift[portIndex] = 0U;
+                continue;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+
+            Port_Base_Address = Port_BaseAddress[portIndex]; /* Port Base Address */
+
+            /* One read of GPIODIR, compared with the expected direction of the refreshed pins */
+            dir   = REG_READ(Port_Base_Address + PORT_DIR_REG_OFFSET);
+            drift = (dir ^ Port_imagePtr[portIndex].dir) & Port_imagePtr[portIndex].refresh_mask;
+
+            if(0U != drift)
+            {
+                /* Flip only the drifted bits back */
+                REG_WRITE(Port_Base_Address + PORT_DIR_REG_OFFSET, (dir ^ drift));
+            }
+            else
+            {
+                /* GPIODIR is as expected ... no write is needed */
+            }
+
+            Port_DirectionDrift[portIndex] = (uint8)drift;
+
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+            /* The refreshed pins are back to their configured direction */
+            Port_SetExpectedBits(&Port_ExpectedImage[portIndex].dir, Port_imagePtr[portIndex].refresh_mask,
+                                 Port_imagePtr[portIndex].dir & Port_imagePtr[portIndex].refresh_mask);
+#endif
+        }
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+}
+
 /************************************************************************************
- * Service Name: Port_Init
- * Service ID[hex]: 0x00
+ * Service Name: Port_GetDirectionDrift
+ * Service ID[hex]: 0x07
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): PortId - Port ID number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint8 - pins of the port that had a wrong direction at the last refresh
+ * Description: Function to get the pins repaired by the last Port_RefreshPortDirection call
+ ************************************************************************************/
+uint8 Port_GetDirectionDrift(uint8 PortId)
+{
+    uint8 drift = 0U;
+    boolean error = FALSE;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PORT_NOT_INITIALIZED == Port_Status)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_GET_DIRECTION_DRIFT_SID, PORT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the used port is within the valid range */
+    else if (PORT_NUMBER_OF_PORTS <= PortId)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_GET_DIRECTION_DRIFT_SID, PORT_E_PARAM_PORT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        drift = Port_DirectionDrift[PortId];
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return drift;
+}
+
+/************************************************************************************
+ * Service Name: Port_GetVersionInfo
+ * Service ID[hex]: 0x03
  * Sync/Async: Synchronous
  * Reentrancy: Non Reentrant
- * Parameters (in): ConfigPtr - Pointer to post-build configuration data
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Version Info - Ptr to where to store the version info of this module.
+ * Return value: None
+ * Description: Function to return the version info of this module
+ ************************************************************************************/
+#if (PORT_VERSION_INFO_API == STD_ON)
+void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
+{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if(NULL_PTR == versioninfo)
+    {
+        /* Report to DET  */
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_GET_VERSION_INFO_SID, PORT_E_PARAM_POINTER);
+    }
+    else
+#endif /* (PORT_DEV_ERROR_DETECT == STD_ON) */
+    {
+        /* Copy the vendor Id */
+        versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
+        /* Copy the module Id */
+        versioninfo->moduleID = (uint16)PORT_MODULE_ID;
+        /* Copy Software Major Version */
+        versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
+        /* Copy Software Minor Version */
+        versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
+        /* Copy Software Patch Version */
+        versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+    }
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_SetPinMode
+ * Service ID[hex]: 0x04
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ *                  Mode - New Port Pin mode to be set on port pin
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to initialize the Port Driver Module
+ * Description: Function to set the port pin mode
  ************************************************************************************/
-void Port_Init(const Port_ConfigType * ConfigPtr)
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode)
 {
-    volatile uint32 * Port_Base_Address_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-    volatile Port_PinType pinIndex = PORT_PIN0_ID;      /* pin index starting with oin 0 */
+    boolean error = FALSE;
 
-    /* Check for development error */
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-    /* check if the input configuration pointer is not a NULL_PTR */
-    if (NULL_PTR == ConfigPtr)
+    /* Check if the Driver is initialized before using this function */
+    if (PORT_NOT_INITIALIZED == Port_Status)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_MODE_SID, PORT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the pin ID is valid */
+    else if (PORT_CONFIGURED_PINS <= Pin)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+        error = TRUE;
+    }
+    /* Checks if the pin mode is changeable */
+    else if (PORT_PIN_MODE_NOT_CHANGEABLE == PORT_PIN_CFG_MODE_CHANGEABLE(Port_configPtr[Pin]))
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
+        error = TRUE;
+    }
+    /* Checks if the mode is available on the pin */
+    else if (FALSE == Port_IsModeAvailable(PORT_PIN_CFG_PORT_NUM(Port_configPtr[Pin]), PORT_PIN_CFG_PIN_NUM(Port_configPtr[Pin]), Mode))
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* Set Pin Mode ... one table lookup and one read-modify-write for each of GPIOAMSEL, GPIOAFSEL, GPIOPCTL and GPIODEN */
+        Port_WritePinsMode(PORT_PIN_CFG_PORT_NUM(Port_configPtr[Pin]), (uint8)(1U << PORT_PIN_CFG_PIN_NUM(Port_configPtr[Pin])), Mode);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_SetPinModeBatch
+ * Service ID[hex]: 0x06
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pins - Array of Port Pin ID numbers
+ *                  NumberOfPins - Number of pins in the Pins array
+ *                  Mode - New Port Pin mode to be set on all the pins
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to set the mode of several port pins, the pins are grouped
+ *              by port and each of GPIOAMSEL, GPIOAFSEL, GPIOPCTL and GPIODEN is
+ *              written once per port. Nothing is changed in-case any of the pins is invalid.
+ ************************************************************************************/
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+void Port_SetPinModeBatch(const Port_PinType * Pins, uint8 NumberOfPins, Port_PinModeType Mode)
+{
+    uint8 Port_Pins_Mask[PORT_NUMBER_OF_PORTS] = {0U}; /* pins to be changed in each port */
+    uint8 pinIndex;
+    uint8 portIndex;
+    boolean error = FALSE;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PORT_NOT_INITIALIZED == Port_Status)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_MODE_BATCH_SID, PORT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the input pins pointer is not a NULL_PTR */
+    else if (NULL_PTR == Pins)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_PIN_MODE_BATCH_SID, PORT_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    else
+    {
+        for(pinIndex = 0U; pinIndex < NumberOfPins; pinIndex++)
+        {
+            /* Check if the pin ID is valid */
+            if (PORT_CONFIGURED_PINS <= Pins[pinIndex])
+            {
+                Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                                PORT_SET_PIN_MODE_BATCH_SID, PORT_E_PARAM_PIN);
+                error = TRUE;
+            }
+            /* Checks if the pin mode is changeable */
+            else if (PORT_PIN_MODE_NOT_CHANGEABLE == PORT_PIN_CFG_MODE_CHANGEABLE(Port_configPtr[Pins[pinIndex]]))
+            {
+                Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                                PORT_SET_PIN_MODE_BATCH_SID, PORT_E_MODE_UNCHANGEABLE);
+                error = TRUE;
+            }
+            /* Checks if the mode is available on the pin */
+            else if (FALSE == Port_IsModeAvailable(PORT_PIN_CFG_PORT_NUM(Port_configPtr[Pins[pinIndex]]), PORT_PIN_CFG_PIN_NUM(Port_configPtr[Pins[pinIndex]]), Mode))
+            {
+                Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                                PORT_SET_PIN_MODE_BATCH_SID, PORT_E_PARAM_INVALID_MODE);
+                error = TRUE;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* Group the pins by port first */
+        for(pinIndex = 0U; pinIndex < NumberOfPins; pinIndex++)
+        {
+            SET_BIT(Port_Pins_Mask[PORT_PIN_CFG_PORT_NUM(Port_configPtr[Pins[pinIndex]])], PORT_PIN_CFG_PIN_NUM(Port_configPtr[Pins[pinIndex]]));
+        }
+
+        /* Then compose and write the mode registers of each affected port once */
+        for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
+        {
+            if(0U != Port_Pins_Mask[portIndex])
+            {
+                Port_WritePinsMode(portIndex, Port_Pins_Mask[portIndex], Mode);
+            }
+            else
+            {
+                /* No pins to be changed in this port */
+            }
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_VerifyAndRepair
+ * Service ID[hex]: 0x08
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint8 - number of registers repaired during this call
+ * Description: Function to compare the configuration registers of each port with the
+ *              expected port image and repair the registers that drifted:
+ *              - one read per register and port, compared as a whole word
+ *              - one write per drifted register, flipping the drifted bits only
+ *              - the repair call back is called for each repaired port
+ ************************************************************************************/
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+uint8 Port_VerifyAndRepair(void)
+{
+    uint32 Port_Base_Address = 0U;
+    const Port_PortImageType * Image_Ptr = NULL_PTR;
+    uint8 portIndex;
+    uint8 portRepaired;
+    uint8 totalRepaired = 0U;
+    uint32 pins_mask;
+    boolean error = FALSE;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PORT_NOT_INITIALIZED == Port_Status)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_VERIFY_AND_REPAIR_SID, PORT_E_UNINIT);
+        error = TRUE;
     }
     else
-#endif
     {
-        /*
-         * Set the module state to initialized and point to the PB configuration structure using a global pointer.
-         * This global pointer is global to be used by other functions to read the PB configuration structures
-         */
-        Port_Status = PORT_INITIALIZED;
-        Port_configPtr = ConfigPtr->Pin; /* address of the first Pin structure --> Pin[0] */
+        /* No Action Required */
     }
+#endif
 
-    for(pinIndex = PORT_PIN0_ID; pinIndex < PORT_CONFIGURED_PINS; pinIndex++)
+    /* In-case there are no errors */
+    if(FALSE == error)
     {
-        switch(Port_configPtr[pinIndex].port_num)
-        {
-        case PORT_PORTA_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-            break;
-        case PORT_PORTB_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-            break;
-        case PORT_PORTC_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-            break;
-        case PORT_PORTD_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-            break;
-        case PORT_PORTE_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-            break;
-        case PORT_PORTF_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-            break;
-        }
-
-        if( ((Port_configPtr[pinIndex].port_num == PORT_PORTD_ID) && (Port_configPtr[pinIndex].pin_num == PORT_PIN7_ID)) || \
-                ((Port_configPtr[pinIndex].port_num == PORT_PORTF_ID) && (Port_configPtr[pinIndex].pin_num == PORT_PIN0_ID)) ) /* PD7 or PF0 */
-        {
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;                     /* Unlock the GPIOCR register */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_LOCK_REG_OFFSET) , Port_configPtr[pinIndex].port_num);  /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-        }
-        else if( (Port_configPtr[pinIndex].port_num == PORT_PORTC_ID) && (Port_configPtr[pinIndex].pin_num <= PORT_PIN3_ID) ) /* PC0 to PC3 */
-        {
-            /* Do Nothing ...  this is the JTAG pins */
-            continue;
-        }
-        else
-        {
-            /* Do Nothing ... No need to unlock the commit register for this pin */
-        }
-
-        /* Set Pin Direction */
-        if(Port_configPtr[pinIndex].pin_direction == PORT_PIN_OUT)
+        for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
         {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);               /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+            Image_Ptr = &Port_ExpectedImage[portIndex];
+            pins_mask = (uint32)Image_Ptr->pin_mask;
 
-            if(Port_configPtr[pinIndex].pin_initial_value == STD_HIGH)
+            if(0U == pins_mask)
             {
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DATA_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);          /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
+                /* No configured pins in this port */
+                continue;
             }
             else
             {
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DATA_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);        /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
+                /* No Action Required */
             }
-        }
-        else if(Port_configPtr[pinIndex].pin_direction == PORT_PIN_IN)
-        {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);             /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
 
-            if(Port_configPtr[pinIndex].pin_resistor == PULL_UP)
-            {
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);       /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-            }
-            else if(Port_configPtr[pinIndex].pin_resistor == PULL_DOWN)
+            Port_Base_Address = Port_BaseAddress[portIndex]; /* Port Base Address */
+
+            portRepaired  = Port_RepairRegister(Port_Base_Address, PORT_DIR_REG_OFFSET, Image_Ptr->dir, pins_mask);
+            portRepaired += Port_RepairRegister(Port_Base_Address, PORT_PULL_UP_REG_OFFSET, Image_Ptr->pur, pins_mask);
+            portRepaired += Port_RepairRegister(Port_Base_Address, PORT_PULL_DOWN_REG_OFFSET, Image_Ptr->pdr, pins_mask);
+            portRepaired += Port_RepairRegister(Port_Base_Address, PORT_ANALOG_MODE_SEL_REG_OFFSET, Image_Ptr->amsel, pins_mask);
+            portRepaired += Port_RepairRegister(Port_Base_Address, PORT_ALT_FUNC_REG_OFFSET, Image_Ptr->afsel, pins_mask);
+            portRepaired += Port_RepairRegister(Port_Base_Address, PORT_CTL_REG_OFFSET, Image_Ptr->pctl, Port_PctlPinsMask[portIndex]);
+            portRepaired += Port_RepairRegister(Port_Base_Address, PORT_DIGITAL_ENABLE_REG_OFFSET, Image_Ptr->den, pins_mask);
+
+            if(0U != portRepaired)
             {
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);     /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
+                totalRepaired += portRepaired;
+
+                /* Check if the Port_SetRepairCallBack is already called */
+                if(Port_Repair_Call_Back_Ptr != NULL_PTR)
+                {
+                    (*Port_Repair_Call_Back_Ptr)(portIndex, portRepaired); /* report the repaired registers of this port */
+                }
+                else
+                {
+                    /* No Action Required */
+                }
             }
             else
             {
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);     /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);   /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
+                /* All the registers of this port are as expected */
             }
         }
-        else
-        {
-            /* Do Nothing */
-        }
-
-        /* Set Pin Mode */
-        if(Port_configPtr[pinIndex].pin_mode == PORT_PIN_MODE_DIO) /* DIO Mode */
-        {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));     /* Clear the PMCx bits for this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-        }
-        else if(Port_configPtr[pinIndex].pin_mode == PORT_PIN_MODE_ADC) /* ADC Mode */
-        {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);        /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));     /* Clear the PMCx bits for this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);       /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-        }
-        else /* Any other Mode */
-        {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);               /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));     /* Clear the PMCx bits for this pin first */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_CTL_REG_OFFSET) |= (0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));      /* Then Set the PMCx bits for this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-        }
     }
+    else
+    {
+        /* Do Nothing */
+    }
+    return totalRepaired;
 }
 
 /************************************************************************************
- * Service Name: Port_SetPinDirection
- * Service ID[hex]: 0x01
+ * Service Name: Port_SetRepairCallBack
+ * Service ID[hex]: 0x0D
  * Sync/Async: Synchronous
- * Reentrancy: Reentrant
- * Parameters (in): Pin - Port Pin ID number
- *                  Direction - Port Pin Direction
+ * Reentrancy: reentrant
+ * Parameters (in): Ptr2Func - Call Back function address
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to set the port pin direction
+ * Description: Function to setup the call back function called by Port_VerifyAndRepair
+ *              with the port ID and the number of repaired registers of this port.
  ************************************************************************************/
-#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
-void Port_SetPinDirection(Port_PinType Pin,Port_PinDirectionType Direction)
+void Port_SetRepairCallBack(void(*Ptr2Func)(uint8 PortId, uint8 RepairedRegisters))
 {
-    volatile uint32 * Port_Base_Address_Ptr = NULL_PTR;
     boolean error = FALSE;
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
@@ -184,31 +1307,57 @@ void Port_SetPinDirection(Port_PinType Pin,Port_PinDirectionType Direction)
     if (PORT_NOT_INITIALIZED == Port_Status)
     {
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-                        PORT_SET_PIN_DIRECTION_SID, PORT_E_UNINIT);
+                        PORT_SET_REPAIR_CALL_BACK_SID, PORT_E_UNINIT);
         error = TRUE;
     }
     else
     {
         /* No Action Required */
     }
-    /* Check if the pin ID is valid */
-    if (PORT_CONFIGURED_PINS <= Pin)
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-                        PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
-        error = TRUE;
+        Port_Repair_Call_Back_Ptr = Ptr2Func;
     }
     else
     {
-        /* No Action Required */
+        /* Do Nothing */
     }
+}
+#endif
 
-    /* Checks if the pin direction is changeable */
-    if (PORT_PIN_DIRECTION_NOT_CHANGEABLE == Port_configPtr[Pin].pin_direction_changeable)
+/************************************************************************************
+ * Service Name: Port_SetEdgeCallBack
+ * Service ID[hex]: 0x09
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ *                  Ptr2Func - Call Back function address
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to setup the call back function called from the port
+ *              interrupt when the configured edge is detected on the pin.
+ ************************************************************************************/
+void Port_SetEdgeCallBack(Port_PinType Pin, void(*Ptr2Func)(void))
+{
+    boolean error = FALSE;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PORT_NOT_INITIALIZED == Port_Status)
     {
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-                        PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
-
+                        PORT_SET_EDGE_CALL_BACK_SID, PORT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the used pin is within the valid range */
+    else if (PORT_CONFIGURED_PINS <= Pin)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SET_EDGE_CALL_BACK_SID, PORT_E_PARAM_PIN);
         error = TRUE;
     }
     else
@@ -220,64 +1369,34 @@ void Port_SetPinDirection(Port_PinType Pin,Port_PinDirectionType Direction)
     /* In-case there are no errors */
     if(FALSE == error)
     {
-        switch(Port_configPtr[Pin].port_num)
-        {
-        case PORT_PORTA_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-            break;
-        case PORT_PORTB_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-            break;
-        case PORT_PORTC_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-            break;
-        case PORT_PORTD_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-            break;
-        case PORT_PORTE_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-            break;
-        case PORT_PORTF_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-            break;
-        }
-
-        /* Set Pin Direction */
-        if(PORT_PIN_OUT == Direction)
-        {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[Pin].pin_num);               /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-        }
-        else if(PORT_PIN_IN == Direction)
-        {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[Pin].pin_num);             /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-        }
-        else
-        {
-            /* Do Nothing */
-        }
+        Port_Edge_Call_Back_Ptr[PORT_PIN_CFG_PORT_NUM(Port_configPtr[Pin])][PORT_PIN_CFG_PIN_NUM(Port_configPtr[Pin])] = Ptr2Func;
     }
     else
     {
         /* Do Nothing */
     }
 }
-#endif
 
 /************************************************************************************
- * Service Name: Port_RefreshPortDirection
- * Service ID[hex]: 0x02
+ * Service Name: Port_SaveContext
+ * Service ID[hex]: 0x0A
  * Sync/Async: Synchronous
  * Reentrancy: Non Reentrant
  * Parameters (in): None
  * Parameters (inout): None
- * Parameters (out): None
+ * Parameters (out): ContextPtr - Pointer to where to store the state of the ports
  * Return value: None
- * Description: Function to refresh port direction
+ * Description: Function to read the configuration and data registers of each port
+ *              with configured pins once and store them whole, only GPIODATA is
+ *              limited to the configured pins.
  ************************************************************************************/
-void Port_RefreshPortDirection(void)
+#if (PORT_CONTEXT_API == STD_ON)
+void Port_SaveContext(Port_ContextType * ContextPtr)
 {
-    volatile uint32 *Port_Base_Address_Ptr = NULL_PTR;
-    volatile Port_PinType pinIndex = PORT_PIN0_ID;
+    uint32 Port_Base_Address = 0U;
+    Port_PortImageType * Context_Ptr = NULL_PTR;
+    uint32 pin_mask;
+    uint8 portIndex;
     boolean error = FALSE;
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
@@ -285,7 +1404,14 @@ void Port_RefreshPortDirection(void)
     if (PORT_NOT_INITIALIZED == Port_Status)
     {
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-                        PORT_REFRESH_PORT_DIRECTION_SID, PORT_E_UNINIT);
+                        PORT_SAVE_CONTEXT_SID, PORT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the input context pointer is not a NULL_PTR */
+    else if (NULL_PTR == ContextPtr)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_SAVE_CONTEXT_SID, PORT_E_PARAM_POINTER);
         error = TRUE;
     }
     else
@@ -297,113 +1423,141 @@ void Port_RefreshPortDirection(void)
     /* In-case there are no errors */
     if(FALSE == error)
     {
-        switch(Port_configPtr[pinIndex].port_num)
-        {
-        case PORT_PORTA_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-            break;
-        case PORT_PORTB_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-            break;
-        case PORT_PORTC_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-            break;
-        case PORT_PORTD_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-            break;
-        case PORT_PORTE_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-            break;
-        case PORT_PORTF_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-            break;
-        }
-
-        for(pinIndex = PORT_PIN0_ID; pinIndex < PORT_CONFIGURED_PINS; pinIndex++)
-        {
-            if(Port_configPtr[pinIndex].pin_direction_changeable == PORT_PIN_DIRECTION_CHANGEABLE)
-            {
-                /* Set Pin Direction */
-                if(Port_configPtr[pinIndex].pin_direction == PORT_PIN_OUT)
-                {
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);               /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-                }
-                else if(Port_configPtr[pinIndex].pin_direction == PORT_PIN_IN)
-                {
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);             /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-                }
-                else
-                {
-                    /* Do Nothing */
-                }
+        for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
+        {
+            Context_Ptr = &ContextPtr->Port[portIndex];
+
+            /* The configured pins and the locked pins of the port are part of its configuration */
+            *Context_Ptr = Port_imagePtr[portIndex];
+
+            if(0U == Context_Ptr->pin_mask)
+            {
+                /* No configured pins in this port */
+                continue;
             }
             else
             {
-                /*Do Nothing*/
+                /* No Action Required */
             }
+
+            Port_Base_Address = Port_BaseAddress[portIndex]; /* Port Base Address */
+            pin_mask = (uint32)Context_Ptr->pin_mask;
+
+            /* One read per register ... the whole value is kept so the restore does not have to read it again */
+            Context_Ptr->dir   = REG_READ(Port_Base_Address + PORT_DIR_REG_OFFSET);
+            Context_Ptr->data  = REG_READ(Port_Base_Address + (pin_mask << 2));
+            Context_Ptr->pur   = REG_READ(Port_Base_Address + PORT_PULL_UP_REG_OFFSET);
+            Context_Ptr->pdr   = REG_READ(Port_Base_Address + PORT_PULL_DOWN_REG_OFFSET);
+            Context_Ptr->amsel = REG_READ(Port_Base_Address + PORT_ANALOG_MODE_SEL_REG_OFFSET);
+            Context_Ptr->afsel = REG_READ(Port_Base_Address + PORT_ALT_FUNC_REG_OFFSET);
+            Context_Ptr->pctl  = REG_READ(Port_Base_Address + PORT_CTL_REG_OFFSET);
+            Context_Ptr->den   = REG_READ(Port_Base_Address + PORT_DIGITAL_ENABLE_REG_OFFSET);
+
+            /* The interrupt registers can be changed at runtime ... they are read as the other registers */
+            Context_Ptr->is    = REG_READ(Port_Base_Address + PORT_INT_SENSE_REG_OFFSET);
+            Context_Ptr->ibe   = REG_READ(Port_Base_Address + PORT_INT_BOTH_EDGES_REG_OFFSET);
+            Context_Ptr->iev   = REG_READ(Port_Base_Address + PORT_INT_EVENT_REG_OFFSET);
+            Context_Ptr->im    = REG_READ(Port_Base_Address + PORT_INT_MASK_REG_OFFSET);
         }
     }
     else
     {
-        /*Do Nothing*/
+        /* Do Nothing */
     }
 }
 
 /************************************************************************************
- * Service Name: Port_GetVersionInfo
- * Service ID[hex]: 0x03
+ * Service Name: Port_RestoreContext
+ * Service ID[hex]: 0x0B
  * Sync/Async: Synchronous
  * Reentrancy: Non Reentrant
- * Parameters (in): None
+ * Parameters (in): ContextPtr - Pointer to the state saved by Port_SaveContext
  * Parameters (inout): None
- * Parameters (out): Version Info - Ptr to where to store the version info of this module.
+ * Parameters (out): None
  * Return value: None
- * Description: Function to return the version info of this module
+ * Description: Function to write the saved state back to the ports in the same order
+ *              as Port_Init, the locked pins are committed first and GPIODEN is the
+ *              last configuration register, each register is written once without
+ *              reading it as the saved values are whole registers.
  ************************************************************************************/
-#if (PORT_VERSION_INFO_API == STD_ON)
-void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
+void Port_RestoreContext(const Port_ContextType * ContextPtr)
 {
+    uint8 portIndex;
+    boolean error = FALSE;
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-    /* Check if input pointer is not Null pointer */
-    if(NULL_PTR == versioninfo)
+    /* Check if the Driver is initialized before using this function */
+    if (PORT_NOT_INITIALIZED == Port_Status)
     {
-        /* Report to DET  */
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-                        PORT_GET_VERSION_INFO_SID, PORT_E_PARAM_POINTER);
+                        PORT_RESTORE_CONTEXT_SID, PORT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the input context pointer is not a NULL_PTR */
+    else if (NULL_PTR == ContextPtr)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+                        PORT_RESTORE_CONTEXT_SID, PORT_E_PARAM_POINTER);
+        error = TRUE;
     }
     else
-#endif /* (PORT_DEV_ERROR_DETECT == STD_ON) */
     {
-        /* Copy the vendor Id */
-        versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
-        /* Copy the module Id */
-        versioninfo->moduleID = (uint16)PORT_MODULE_ID;
-        /* Copy Software Major Version */
-        versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
-        /* Copy Software Minor Version */
-        versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
-        /* Copy Software Patch Version */
-        versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
+        {
+            if(0U == ContextPtr->Port[portIndex].pin_mask)
+            {
+                /* No configured pins in this port */
+                continue;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+
+            /* The interrupt registers are always restored ... the pins masked before the low-power entry are masked again */
+            Port_CommitPortImage(portIndex, &ContextPtr->Port[portIndex],
+                                 Port_ImageRegisters(&ContextPtr->Port[portIndex]) | PORT_IMAGE_REG_INT | PORT_IMAGE_REG_WHOLE);
+
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+            /* The restored state is the expected state of the port */
+            Port_ExpectedImage[portIndex] = ContextPtr->Port[portIndex];
+#endif
+        }
+    }
+    else
+    {
+        /* Do Nothing */
     }
 }
 #endif
 
 /************************************************************************************
- * Service Name: Port_SetPinMode
- * Service ID[hex]: 0x04
+ * Service Name: Port_SwitchVariant
+ * Service ID[hex]: 0x0C
  * Sync/Async: Synchronous
- * Reentrancy: Reentrant
- * Parameters (in): Pin - Port Pin ID number
- *                  Mode - New Port Pin mode to be set on port pin
+ * Reentrancy: Non Reentrant
+ * Parameters (in): VariantId - ID of the post-build configuration variant to apply
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to set the port pin mode
+ * Description: Function to switch the ports from the current configuration variant to
+ *              another one, only the registers that differ between the two variants are
+ *              written using the delta generated for each port in Port_PBcfg.c.
+ *              The registers not in the delta keep the changes of the runtime APIs.
  ************************************************************************************/
-#if (PORT_SET_PIN_MODE_API == STD_ON)
-void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode)
+#if (PORT_VARIANT_API == STD_ON)
+void Port_SwitchVariant(uint8 VariantId)
 {
-    volatile uint32 * Port_Base_Address_Ptr = NULL_PTR;
+    const Port_ConfigType * Variant_Ptr = NULL_PTR;
+    uint16 registers;
+    uint8 portIndex;
     boolean error = FALSE;
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
@@ -411,31 +1565,14 @@ void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode)
     if (PORT_NOT_INITIALIZED == Port_Status)
     {
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-                        PORT_SET_PIN_MODE_SID, PORT_E_UNINIT);
-        error = TRUE;
-    }
-    else
-    {
-        /* No Action Required */
-    }
-    /* Check if the pin ID is valid */
-    if (PORT_CONFIGURED_PINS <= Pin)
-    {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-                        PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+                        PORT_SWITCH_VARIANT_SID, PORT_E_UNINIT);
         error = TRUE;
     }
-    else
-    {
-        /* No Action Required */
-    }
-
-    /* Checks if the pin mode is changeable */
-    if (PORT_PIN_MODE_NOT_CHANGEABLE == Port_configPtr[Pin].pin_mode_changeable)
+    /* Check if the used variant is within the valid range */
+    else if (PORT_NUMBER_OF_VARIANTS <= VariantId)
     {
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-                        PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
-
+                        PORT_SWITCH_VARIANT_SID, PORT_E_PARAM_VARIANT);
         error = TRUE;
     }
     else
@@ -444,55 +1581,36 @@ void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode)
     }
 #endif
 
-    /* In-case there are no errors */
-    if(FALSE == error)
+    /* In-case there are no errors and the variant is not already applied */
+    if((FALSE == error) && (VariantId != Port_CurrentVariant))
     {
-        switch(Port_configPtr[Pin].port_num)
-        {
-        case PORT_PORTA_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-            break;
-        case PORT_PORTB_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-            break;
-        case PORT_PORTC_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-            break;
-        case PORT_PORTD_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-            break;
-        case PORT_PORTE_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-            break;
-        case PORT_PORTF_ID:
-            Port_Base_Address_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-            break;
-        }
-
-        /* Set Pin Mode */
-        if(Mode == PORT_PIN_MODE_DIO) /* DIO Mode */
-        {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[Pin].pin_num);             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[Pin].pin_num * 4));     /* Clear the PMCx bits for this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[Pin].pin_num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-        }
-        else if(Mode == PORT_PIN_MODE_ADC) /* ADC Mode */
-        {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);        /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[Pin].pin_num);             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[Pin].pin_num * 4));     /* Clear the PMCx bits for this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[Pin].pin_num);       /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-        }
-        else /* Any other Mode */
+        Variant_Ptr = Port_Variants[VariantId];
+
+        for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[Pin].pin_num);               /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[Pin].pin_num * 4));     /* Clear the PMCx bits for this pin first */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_CTL_REG_OFFSET) |= (0x0000000F << (Port_configPtr[Pin].pin_num * 4));      /* Then Set the PMCx bits for this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[Pin].pin_num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
+            registers = Variant_Ptr->Delta[Port_CurrentVariant][portIndex];
+
+            if(0U == registers)
+            {
+                /* The port is the same in both variants */
+                continue;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+
+            Port_CommitPortImage(portIndex, &Variant_Ptr->Port[portIndex], registers);
+
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+            /* The written registers of the new variant are the expected state of the port */
+            Port_SetExpectedRegisters(portIndex, &Variant_Ptr->Port[portIndex], registers);
+#endif
         }
 
+        Port_configPtr = Variant_Ptr->Pin;
+        Port_imagePtr = Variant_Ptr->Port;
+        Port_CurrentVariant = VariantId;
     }
     else
     {
@@ -500,3 +1618,36 @@ void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode)
     }
 }
 #endif
+
+/************************************************************************************
+ * GPIO ports interrupt service routines
+ ************************************************************************************/
+void GPIOPortA_Handler(void)
+{
+    Port_EdgeHandler(PORT_PORTA_ID);
+}
+
+void GPIOPortB_Handler(void)
+{
+    Port_EdgeHandler(PORT_PORTB_ID);
+}
+
+void GPIOPortC_Handler(void)
+{
+    Port_EdgeHandler(PORT_PORTC_ID);
+}
+
+void GPIOPortD_Handler(void)
+{
+    Port_EdgeHandler(PORT_PORTD_ID);
+}
+
+void GPIOPortE_Handler(void)
+{
+    Port_EdgeHandler(PORT_PORTE_ID);
+}
+
+void GPIOPortF_Handler(void)
+{
+    Port_EdgeHandler(PORT_PORTF_ID);
+}
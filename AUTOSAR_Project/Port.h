@@ -87,6 +87,33 @@
 /* Service ID for PORT Set Pin Mode */
 #define PORT_SET_PIN_MODE_SID                     (uint8)0x04
 
+/* Service ID for PORT Set Pin Direction Batch */
+#define PORT_SET_PIN_DIRECTION_BATCH_SID          (uint8)0x05
+
+/* Service ID for PORT Set Pin Mode Batch */
+#define PORT_SET_PIN_MODE_BATCH_SID               (uint8)0x06
+
+/* Service ID for PORT Get Direction Drift */
+#define PORT_GET_DIRECTION_DRIFT_SID              (uint8)0x07
+
+/* Service ID for PORT Verify And Repair */
+#define PORT_VERIFY_AND_REPAIR_SID                (uint8)0x08
+
+/* Service ID for PORT Set Edge Call Back */
+#define PORT_SET_EDGE_CALL_BACK_SID               (uint8)0x09
+
+/* Service ID for PORT Save Context */
+#define PORT_SAVE_CONTEXT_SID                     (uint8)0x0A
+
+/* Service ID for PORT Restore Context */
+#define PORT_RESTORE_CONTEXT_SID                  (uint8)0x0B
+
+/* Service ID for PORT Switch Variant */
+#define PORT_SWITCH_VARIANT_SID                   (uint8)0x0C
+
+/* Service ID for PORT Set Repair Call Back */
+#define PORT_SET_REPAIR_CALL_BACK_SID             (uint8)0x0D
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -110,6 +137,12 @@
 /*APIs called with a Null Pointer*/
 #define PORT_E_PARAM_POINTER                       (uint8)0x10
 
+/* DET code to report Invalid Port ID */
+#define PORT_E_PARAM_PORT                          (uint8)0x11
+
+/* DET code to report Invalid Configuration Variant ID */
+#define PORT_E_PARAM_VARIANT                       (uint8)0x12
+
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -154,6 +187,12 @@ typedef enum
     PORT_PIN_MODE_SPI
 }Port_PinInitialModeType;
 
+/*Edge of an input pin that raises the port interrupt*/
+typedef enum
+{
+    PORT_PIN_EDGE_NONE, PORT_PIN_EDGE_RISING, PORT_PIN_EDGE_FALLING, PORT_PIN_EDGE_BOTH
+}Port_PinEdgeType;
+
 /*Pin Direction Changeable or not*/
 #define PORT_PIN_DIRECTION_CHANGEABLE             (STD_ON)
 #define PORT_PIN_DIRECTION_NOT_CHANGEABLE         (STD_OFF)
@@ -162,34 +201,126 @@ typedef enum
 #define PORT_PIN_MODE_CHANGEABLE                  (STD_ON)
 #define PORT_PIN_MODE_NOT_CHANGEABLE              (STD_OFF)
 
-/* Description: Structure to configure each individual Pin:
- *	1. the PORT Which the pin belongs to --> 0, 1, 2, 3, 4 or 5
- *	2. the number of the pin in the PORT --> 0, 1, 2, 3, 4, 5, 6, 7
- *  3. the direction of pin --> PORT_PIN_IN or PORT_PIN_OUT
- *  4. the internal resistor --> OFF, PULL_UP up or Pull PULL_DOWN
- *  5. the pin mode --> DIO, ADC, SPI, or...
- *  6. the pin direction changeable during runtime --> STD_ON or STD_OFF
- *  7. the pin mode changeable during runtime --> STD_ON or STD_OFF
- *  8. the pin initial value level --> PORT_PIN_LEVEL_LOW or PORT_PIN_LEVEL_HIGH
+/* Description: Packed configuration of each individual Pin, one bit field per item:
+ *	1. the PORT Which the pin belongs to --> 0, 1, 2, 3, 4 or 5                              --> bits 0 to 2
+ *	2. the number of the pin in the PORT --> 0, 1, 2, 3, 4, 5, 6, 7                          --> bits 3 to 5
+ *  3. the direction of pin --> PORT_PIN_IN or PORT_PIN_OUT                                --> bit 6
+ *  4. the internal resistor --> OFF, PULL_UP up or Pull PULL_DOWN                         --> bits 7 to 8
+ *  5. the pin mode --> DIO, ADC, SPI, or...                                               --> bits 9 to 12
+ *  6. the pin direction changeable during runtime --> STD_ON or STD_OFF                   --> bit 13
+ *  7. the pin mode changeable during runtime --> STD_ON or STD_OFF                        --> bit 14
+ *  8. the pin initial value level --> PORT_PIN_LEVEL_LOW or PORT_PIN_LEVEL_HIGH           --> bit 15
+ *  9. the pin interrupt edge --> PORT_PIN_EDGE_NONE, RISING, FALLING or BOTH              --> bits 16 to 17
+ * The entries are built with PORT_PIN_CONFIG and read with the PORT_PIN_CFG_xxx accessors.
+ */
+typedef uint32 Port_ConfigPin;
+
+#define PORT_PIN_CFG_PORT_NUM_SHIFT               (0U)
+#define PORT_PIN_CFG_PORT_NUM_MASK                (0x7U)
+#define PORT_PIN_CFG_PIN_NUM_SHIFT                (3U)
+#define PORT_PIN_CFG_PIN_NUM_MASK                 (0x7U)
+#define PORT_PIN_CFG_DIRECTION_SHIFT              (6U)
+#define PORT_PIN_CFG_DIRECTION_MASK               (0x1U)
+#define PORT_PIN_CFG_RESISTOR_SHIFT               (7U)
+#define PORT_PIN_CFG_RESISTOR_MASK                (0x3U)
+#define PORT_PIN_CFG_MODE_SHIFT                   (9U)
+#define PORT_PIN_CFG_MODE_MASK                    (0xFU)
+#define PORT_PIN_CFG_DIRECTION_CH_SHIFT           (13U)
+#define PORT_PIN_CFG_DIRECTION_CH_MASK            (0x1U)
+#define PORT_PIN_CFG_MODE_CH_SHIFT                (14U)
+#define PORT_PIN_CFG_MODE_CH_MASK                 (0x1U)
+#define PORT_PIN_CFG_LEVEL_SHIFT                  (15U)
+#define PORT_PIN_CFG_LEVEL_MASK                   (0x1U)
+#define PORT_PIN_CFG_EDGE_SHIFT                   (16U)
+#define PORT_PIN_CFG_EDGE_MASK                    (0x3U)
+
+/* Bit field FIELD of a packed pin configuration value */
+#define PORT_PIN_CFG_ENCODE(Field, Value) \
+    (((uint32)(Value) & PORT_PIN_CFG_##Field##_MASK) << PORT_PIN_CFG_##Field##_SHIFT)
+#define PORT_PIN_CFG_DECODE(Field, Cfg) \
+    (((uint32)(Cfg) >> PORT_PIN_CFG_##Field##_SHIFT) & PORT_PIN_CFG_##Field##_MASK)
+
+/* Packed configuration of one pin */
+#define PORT_PIN_CONFIG(Port, Pin, Dir, Res, Mode, DirCh, ModeCh, Level, Edge) \
+    (PORT_PIN_CFG_ENCODE(PORT_NUM, Port) | PORT_PIN_CFG_ENCODE(PIN_NUM, Pin) | \
+     PORT_PIN_CFG_ENCODE(DIRECTION, Dir) | PORT_PIN_CFG_ENCODE(RESISTOR, Res) | \
+     PORT_PIN_CFG_ENCODE(MODE, Mode) | PORT_PIN_CFG_ENCODE(DIRECTION_CH, DirCh) | \
+     PORT_PIN_CFG_ENCODE(MODE_CH, ModeCh) | PORT_PIN_CFG_ENCODE(LEVEL, Level) | \
+     PORT_PIN_CFG_ENCODE(EDGE, Edge))
+
+/* Accessors of each item of a packed pin configuration */
+#define PORT_PIN_CFG_PORT_NUM(Cfg)                ((uint8)PORT_PIN_CFG_DECODE(PORT_NUM, Cfg))
+#define PORT_PIN_CFG_PIN_NUM(Cfg)                 ((Port_PinType)PORT_PIN_CFG_DECODE(PIN_NUM, Cfg))
+#define PORT_PIN_CFG_DIRECTION(Cfg)               ((Port_PinDirectionType)PORT_PIN_CFG_DECODE(DIRECTION, Cfg))
+#define PORT_PIN_CFG_RESISTOR(Cfg)                ((Port_InternalResistorType)PORT_PIN_CFG_DECODE(RESISTOR, Cfg))
+#define PORT_PIN_CFG_MODE(Cfg)                    ((Port_PinModeType)PORT_PIN_CFG_DECODE(MODE, Cfg))
+#define PORT_PIN_CFG_DIRECTION_CHANGEABLE(Cfg)    ((uint8)PORT_PIN_CFG_DECODE(DIRECTION_CH, Cfg))
+#define PORT_PIN_CFG_MODE_CHANGEABLE(Cfg)         ((uint8)PORT_PIN_CFG_DECODE(MODE_CH, Cfg))
+#define PORT_PIN_CFG_INITIAL_VALUE(Cfg)           ((Port_PinLevelValueType)PORT_PIN_CFG_DECODE(LEVEL, Cfg))
+#define PORT_PIN_CFG_EDGE(Cfg)                    ((Port_PinEdgeType)PORT_PIN_CFG_DECODE(EDGE, Cfg))
+
+/* Description: Structure to hold the register image of one port:
+ *  1. the configured pins of the port --> bit n set if pin n is configured
+ *  2. the locked pins (PD7, PF0) that need to be committed before configuring them
+ *  3. the pins whose direction is refreshed by Port_RefreshPortDirection
+ *  4. the value of each GPIO register for the configured pins
+ *  5. the interrupt registers, is is clear for the edge pins and im is set for the pins that raise the port interrupt
  */
 typedef struct
 {
-    uint8 port_num;
-    Port_PinType pin_num;
-    Port_PinDirectionType pin_direction;
-    Port_InternalResistorType pin_resistor;
-    Port_PinModeType pin_mode;
-    uint8 pin_direction_changeable;
-    uint8 pin_mode_changeable;
-    Port_PinLevelValueType pin_initial_value;
-}Port_ConfigPin;
-
-/* Array of Structures for all configured pins */
+    uint8 pin_mask;
+    uint8 commit_mask;
+    uint8 refresh_mask;
+    uint32 dir;
+    uint32 data;
+    uint32 pur;
+    uint32 pdr;
+    uint32 amsel;
+    uint32 afsel;
+    uint32 pctl;
+    uint32 den;
+    uint32 is;
+    uint32 ibe;
+    uint32 iev;
+    uint32 im;
+}Port_PortImageType;
+
+/* Registers of a port image, each bit selects the GPIO registers written for it */
+#define PORT_IMAGE_REG_COMMIT                     (uint16)0x0001    /* GPIOLOCK and GPIOCR */
+#define PORT_IMAGE_REG_DIR                        (uint16)0x0002
+#define PORT_IMAGE_REG_DATA                       (uint16)0x0004
+#define PORT_IMAGE_REG_PUR                        (uint16)0x0008
+#define PORT_IMAGE_REG_PDR                        (uint16)0x0010
+#define PORT_IMAGE_REG_AMSEL                      (uint16)0x0020
+#define PORT_IMAGE_REG_AFSEL                      (uint16)0x0040
+#define PORT_IMAGE_REG_PCTL                       (uint16)0x0080
+#define PORT_IMAGE_REG_DEN                        (uint16)0x0100
+#define PORT_IMAGE_REG_INT                        (uint16)0x0200    /* GPIOIS, GPIOIBE, GPIOIEV, GPIOICR and GPIOIM */
+#define PORT_IMAGE_REG_ALL                        (uint16)0x03FF
+#define PORT_IMAGE_REG_WHOLE                      (uint16)0x0400    /* whole register values ... the pins that are not configured are written too */
+
+/* Description: Structure of the Port Driver configuration:
+ *  1. the variant ID of this configuration --> PORT_VARIANT_NORMAL, DIAGNOSTIC or LIMP_HOME
+ *  2. Array of Structures for all configured pins
+ *  3. Register image of each port generated from the same pins at compile time
+ *  4. the registers of each port written to switch from each variant to this one, generated at compile time
+ */
 typedef struct
 {
+    uint8 VariantId;
     Port_ConfigPin Pin[PORT_CONFIGURED_PINS];
+    Port_PortImageType Port[PORT_NUMBER_OF_PORTS];
+    uint16 Delta[PORT_NUMBER_OF_VARIANTS][PORT_NUMBER_OF_PORTS];
 }Port_ConfigType;
 
+/* Description: Structure to hold the saved state of the configured pins:
+ *  1. Register image of each port read back whole from the hardware by Port_SaveContext
+ */
+typedef struct
+{
+    Port_PortImageType Port[PORT_NUMBER_OF_PORTS];
+}Port_ContextType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -207,9 +338,17 @@ void Port_Init(const Port_ConfigType *ConfigPtr);
 void Port_SetPinDirection(Port_PinType Pin,Port_PinDirectionType Direction);
 #endif
 
+/* Function for Port Set Pin Direction Batch API */
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+void Port_SetPinDirectionBatch(const Port_PinType * Pins, uint8 NumberOfPins, Port_PinDirectionType Direction);
+#endif
+
 /* Function for Refresh Port Direction API */
 void Port_RefreshPortDirection(void);
 
+/* Function to get the pins of a port that drifted at the last direction refresh */
+uint8 Port_GetDirectionDrift(uint8 PortId);
+
 /* Function for Port Get Version Info API */
 #if (PORT_VERSION_INFO_API == STD_ON)
 void Port_GetVersionInfo(Std_VersionInfoType* versioninfo);
@@ -220,6 +359,31 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo);
 void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode);
 #endif
 
+/* Function for Port Set Pin Mode Batch API */
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+void Port_SetPinModeBatch(const Port_PinType * Pins, uint8 NumberOfPins, Port_PinModeType Mode);
+#endif
+
+/* Functions for Port Verify And Repair API */
+#if (PORT_VERIFY_REPAIR_API == STD_ON)
+uint8 Port_VerifyAndRepair(void);
+void Port_SetRepairCallBack(void(*Ptr2Func)(uint8 PortId, uint8 RepairedRegisters));
+#endif
+
+/* Function to set the call back of an edge interrupt pin */
+void Port_SetEdgeCallBack(Port_PinType Pin, void(*Ptr2Func)(void));
+
+/* Functions for Port Save And Restore Context API */
+#if (PORT_CONTEXT_API == STD_ON)
+void Port_SaveContext(Port_ContextType * ContextPtr);
+void Port_RestoreContext(const Port_ContextType * ContextPtr);
+#endif
+
+/* Function for Port Switch Variant API */
+#if (PORT_VARIANT_API == STD_ON)
+void Port_SwitchVariant(uint8 VariantId);
+#endif
+
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
@@ -227,4 +391,10 @@ void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode);
 /* Extern PB structures to be used by Dio and other modules */
 extern const Port_ConfigType Port_Configuration;
 
+extern const Port_ConfigType Port_Configuration_Diagnostic;
+extern const Port_ConfigType Port_Configuration_LimpHome;
+
+/* Extern PB structures of all the configuration variants indexed by the variant ID */
+extern const Port_ConfigType * const Port_Variants[PORT_NUMBER_OF_VARIANTS];
+
 #endif /* PORT_H */
@@ -34,9 +34,35 @@
 /* Pre-compile option for Version Info API */
 #define PORT_VERSION_INFO_API                (STD_OFF)
 
+/* Pre-compile option for Verify And Repair API */
+#define PORT_VERIFY_REPAIR_API               (STD_ON)
+
+/* Pre-compile option for Save And Restore Context APIs */
+#define PORT_CONTEXT_API                     (STD_ON)
+
+/* Pre-compile option for Switch Variant API */
+#define PORT_VARIANT_API                     (STD_ON)
+
+/* Pre-compile option to check the generated port images against the pins configuration in Port_Init,
+ * it can be set from the build command line (the host build compiles Port.c a second time with it ON) */
+#ifndef PORT_IMAGE_SELF_CHECK
+#define PORT_IMAGE_SELF_CHECK                (STD_OFF)
+#endif
+
 /* Number of Configured PINS */
 #define PORT_CONFIGURED_PINS                  (39U) //or (43U) if JTAG pins are configured in Port c Pins 0 to 3
 
+/* Number of Post-build configuration variants */
+#define PORT_NUMBER_OF_VARIANTS               (3U)
+
+/* Post-build configuration variants IDs */
+#define PORT_VARIANT_NORMAL                   (0U)
+#define PORT_VARIANT_DIAGNOSTIC               (1U)
+#define PORT_VARIANT_LIMP_HOME                (2U)
+
+/* Number of GPIO Ports (PORTA to PORTF) */
+#define PORT_NUMBER_OF_PORTS                  (6U)
+
 /* Port IDs */
 #define PORT_PORTA_ID                         (0U)
 #define PORT_PORTB_ID                         (1U)
@@ -55,5 +81,8 @@
 #define PORT_PIN6_ID                          (6U)
 #define PORT_PIN7_ID                          (7U)
 
+/* Port Configured Pins Index in the array of packed Port_ConfigPin entries */
+#define PortConf_SW1_PIN_ID_INDEX             (Port_PinType)38 /* PF4 */
+
 
 #endif /* PORT_CFG_H_ */
@@ -6,6 +6,7 @@
  ******************************************************************************/
 
 #include "Port.h"
+#include "Port_Regs.h"
 /*
  * Module Version 1.0.0
  */
@@ -34,53 +35,200 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
+/* Value of a column in each configuration variant */
+#define PORT_VARIANT(VARIANT, NORMAL, DIAGNOSTIC, LIMP_HOME) \
+    (((VARIANT) == PORT_VARIANT_DIAGNOSTIC) ? (DIAGNOSTIC) : ((VARIANT) == PORT_VARIANT_LIMP_HOME) ? (LIMP_HOME) : (NORMAL))
+
+/*
+ * Configured pins, each entry is:
+ * PORT_PIN(PORT_ID, Port,           Pin,           Direction,     Resistor, Mode,               Direction Changeable,           Mode Changeable,           Initial Value,      Edge)
+ *
+ * The table is expanded once to build the per-pin array and once per register and port
+ * to build the register images, so both are always generated from the same entries.
+ * The columns that differ between the configuration variants use PORT_VARIANT(VARIANT, Normal, Diagnostic, Limp-home):
+ *  - Diagnostic --> PA0 and PA1 are the UART diagnostic link and the LEDs are all on for the lamp test
+ *  - Limp-home  --> the red LED is on as a warning lamp and the other LEDs are inputs pulled down
+ *
+ * JTAG Pin configuration --> PORT C PINS 0 to 3 are not configured, to configure them add:
+ *    PORT_PIN(PORT_ID, PORT_PORTC_ID,  PORT_PIN0_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE)
+ *    PORT_PIN(PORT_ID, PORT_PORTC_ID,  PORT_PIN1_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE)
+ *    PORT_PIN(PORT_ID, PORT_PORTC_ID,  PORT_PIN2_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE)
+ *    PORT_PIN(PORT_ID, PORT_PORTC_ID,  PORT_PIN3_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE)
+ * and set PORT_CONFIGURED_PINS to (43U)
+ */
+#define PORT_CONFIGURED_PINS_TABLE(PORT_PIN, PORT_ID, VARIANT) \
+    PORT_PIN(PORT_ID, PORT_PORTA_ID,  PORT_PIN0_ID,  PORT_PIN_IN,   OFF,      PORT_VARIANT(VARIANT, PORT_PIN_MODE_DIO, PORT_PIN_MODE_LIN, PORT_PIN_MODE_DIO),  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTA_ID,  PORT_PIN1_ID,  PORT_PIN_IN,   OFF,      PORT_VARIANT(VARIANT, PORT_PIN_MODE_DIO, PORT_PIN_MODE_LIN, PORT_PIN_MODE_DIO),  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTA_ID,  PORT_PIN2_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTA_ID,  PORT_PIN3_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTA_ID,  PORT_PIN4_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTA_ID,  PORT_PIN5_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTA_ID,  PORT_PIN6_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTA_ID,  PORT_PIN7_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTB_ID,  PORT_PIN0_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTB_ID,  PORT_PIN1_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTB_ID,  PORT_PIN2_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTB_ID,  PORT_PIN3_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTB_ID,  PORT_PIN4_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTB_ID,  PORT_PIN5_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTB_ID,  PORT_PIN6_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTB_ID,  PORT_PIN7_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTC_ID,  PORT_PIN4_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTC_ID,  PORT_PIN5_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTC_ID,  PORT_PIN6_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTC_ID,  PORT_PIN7_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTD_ID,  PORT_PIN0_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTD_ID,  PORT_PIN1_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTD_ID,  PORT_PIN2_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTD_ID,  PORT_PIN3_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTD_ID,  PORT_PIN4_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTD_ID,  PORT_PIN5_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTD_ID,  PORT_PIN6_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTD_ID,  PORT_PIN7_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTE_ID,  PORT_PIN0_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTE_ID,  PORT_PIN1_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTE_ID,  PORT_PIN2_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTE_ID,  PORT_PIN3_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTE_ID,  PORT_PIN4_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTE_ID,  PORT_PIN5_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTF_ID,  PORT_PIN0_ID,  PORT_PIN_IN,   OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTF_ID,  PORT_PIN1_ID,  PORT_PIN_OUT,  OFF,      PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_VARIANT(VARIANT, PORT_PIN_LEVEL_LOW, PORT_PIN_LEVEL_HIGH, PORT_PIN_LEVEL_HIGH),  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTF_ID,  PORT_PIN2_ID,  PORT_VARIANT(VARIANT, PORT_PIN_OUT, PORT_PIN_OUT, PORT_PIN_IN),  PORT_VARIANT(VARIANT, OFF, OFF, PULL_DOWN),  PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_VARIANT(VARIANT, PORT_PIN_LEVEL_LOW, PORT_PIN_LEVEL_HIGH, PORT_PIN_LEVEL_LOW),  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTF_ID,  PORT_PIN3_ID,  PORT_VARIANT(VARIANT, PORT_PIN_OUT, PORT_PIN_OUT, PORT_PIN_IN),  PORT_VARIANT(VARIANT, OFF, OFF, PULL_DOWN),  PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_VARIANT(VARIANT, PORT_PIN_LEVEL_LOW, PORT_PIN_LEVEL_HIGH, PORT_PIN_LEVEL_LOW),  PORT_PIN_EDGE_NONE) \
+    PORT_PIN(PORT_ID, PORT_PORTF_ID,  PORT_PIN4_ID,  PORT_PIN_IN,   PULL_UP,  PORT_PIN_MODE_DIO,  PORT_PIN_DIRECTION_CHANGEABLE,  PORT_PIN_MODE_CHANGEABLE,  PORT_PIN_LEVEL_LOW,  PORT_PIN_EDGE_BOTH)
+
+/* Check that the number of entries matches the configured number of pins */
+#define PORT_PIN_COUNT(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)    + 1U
+#if ((0U PORT_CONFIGURED_PINS_TABLE(PORT_PIN_COUNT, PORT_PORTA_ID, PORT_VARIANT_NORMAL)) != PORT_CONFIGURED_PINS)
+  #error "The number of configured pins in Port_PBcfg.c does not match PORT_CONFIGURED_PINS"
+#endif
+
+/* Check that the mode of each entry is available on its pin in all the variants ... the array size is negative otherwise */
+#define PORT_PIN_MODE_ERROR(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)    + (PORT_PIN_MODE_IS_AVAILABLE(PORT, PIN, MODE) ? 0U : 1U)
+typedef uint8 Port_PinModeCheckType[((0U PORT_CONFIGURED_PINS_TABLE(PORT_PIN_MODE_ERROR, PORT_PORTA_ID, PORT_VARIANT_NORMAL)
+                                         PORT_CONFIGURED_PINS_TABLE(PORT_PIN_MODE_ERROR, PORT_PORTA_ID, PORT_VARIANT_DIAGNOSTIC)
+                                         PORT_CONFIGURED_PINS_TABLE(PORT_PIN_MODE_ERROR, PORT_PORTA_ID, PORT_VARIANT_LIMP_HOME)) == 0U) ? 1 : -1];
+
+/* Check that the modes fit in their bit field and that a packed pin takes 4 bytes at most ... the array size is negative otherwise */
+typedef uint8 Port_ConfigPinCheckType[((PORT_PIN_MODE_SPI <= PORT_PIN_CFG_MODE_MASK) && (sizeof(Port_ConfigPin) <= 4U)) ? 1 : -1];
+
+/* Per-pin array entry */
+#define PORT_PIN_ENTRY(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE) \
+    PORT_PIN_CONFIG(PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE),
+
+/* Bit of the pin in the image of port ID in-case COND is true, JTAG pins (PC0 to PC3) are never part of the images */
+#define PORT_PIN_BIT(ID, PORT, PIN, COND) \
+    ((((ID) == (PORT)) && !(((PORT) == PORT_PORTC_ID) && ((PIN) <= PORT_PIN3_ID)) && (COND)) ? ((uint32)1 << (PIN)) : 0U)
+
+#define PORT_PIN_IS_LOCKED(PORT, PIN) \
+    ((((PORT) == PORT_PORTD_ID) && ((PIN) == PORT_PIN7_ID)) || (((PORT) == PORT_PORTF_ID) && ((PIN) == PORT_PIN0_ID)))
+
+#define PORT_PIN_IS_ALT_FUNC(MODE) \
+    (((MODE) != PORT_PIN_MODE_DIO) && ((MODE) != PORT_PIN_MODE_ADC))
+
+/* Register bits of one pin */
+#define PORT_IMAGE_PIN_MASK(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)    | PORT_PIN_BIT(ID, PORT, PIN, TRUE)
+#define PORT_IMAGE_COMMIT(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)      | PORT_PIN_BIT(ID, PORT, PIN, PORT_PIN_IS_LOCKED(PORT, PIN))
+#define PORT_IMAGE_REFRESH(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)     | PORT_PIN_BIT(ID, PORT, PIN, ((DIR_CH) == PORT_PIN_DIRECTION_CHANGEABLE))
+#define PORT_IMAGE_DIR(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)         | PORT_PIN_BIT(ID, PORT, PIN, ((DIR) == PORT_PIN_OUT))
+#define PORT_IMAGE_DATA(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)        | PORT_PIN_BIT(ID, PORT, PIN, ((DIR) == PORT_PIN_OUT) && ((LEVEL) == PORT_PIN_LEVEL_HIGH))
+#define PORT_IMAGE_PUR(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)         | PORT_PIN_BIT(ID, PORT, PIN, ((DIR) == PORT_PIN_IN) && ((RES) == PULL_UP))
+#define PORT_IMAGE_PDR(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)         | PORT_PIN_BIT(ID, PORT, PIN, ((DIR) == PORT_PIN_IN) && ((RES) == PULL_DOWN))
+#define PORT_IMAGE_AMSEL(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)       | PORT_PIN_BIT(ID, PORT, PIN, ((MODE) == PORT_PIN_MODE_ADC))
+#define PORT_IMAGE_AFSEL(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)       | PORT_PIN_BIT(ID, PORT, PIN, PORT_PIN_IS_ALT_FUNC(MODE))
+#define PORT_IMAGE_PCTL(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE) \
+    | ((PORT_PIN_BIT(ID, PORT, PIN, PORT_PIN_IS_ALT_FUNC(MODE)) != 0U) ? (PORT_PCTL_MODE(PORT, MODE) & ((uint32)0x0000000F << ((PIN) * 4))) : 0U)
+#define PORT_IMAGE_DEN(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)         | PORT_PIN_BIT(ID, PORT, PIN, ((MODE) != PORT_PIN_MODE_ADC))
+#define PORT_IMAGE_IBE(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)         | PORT_PIN_BIT(ID, PORT, PIN, ((EDGE) == PORT_PIN_EDGE_BOTH))
+#define PORT_IMAGE_IEV(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)         | PORT_PIN_BIT(ID, PORT, PIN, ((EDGE) == PORT_PIN_EDGE_RISING))
+#define PORT_IMAGE_IM(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE)          | PORT_PIN_BIT(ID, PORT, PIN, ((EDGE) != PORT_PIN_EDGE_NONE))
+
+/* Register value of port ID in variant VARIANT, OR-ing the bits of all the configured pins */
+#define PORT_IMAGE_REG(REG, ID, VARIANT)    (0U PORT_CONFIGURED_PINS_TABLE(REG, ID, VARIANT))
+
+/* Register image of port ID in variant VARIANT */
+#define PORT_IMAGE(ID, VARIANT) \
+    { \
+        (uint8)PORT_IMAGE_REG(PORT_IMAGE_PIN_MASK, ID, VARIANT), \
+        (uint8)PORT_IMAGE_REG(PORT_IMAGE_COMMIT, ID, VARIANT), \
+        (uint8)PORT_IMAGE_REG(PORT_IMAGE_REFRESH, ID, VARIANT), \
+        PORT_IMAGE_REG(PORT_IMAGE_DIR, ID, VARIANT), \
+        PORT_IMAGE_REG(PORT_IMAGE_DATA, ID, VARIANT), \
+        PORT_IMAGE_REG(PORT_IMAGE_PUR, ID, VARIANT), \
+        PORT_IMAGE_REG(PORT_IMAGE_PDR, ID, VARIANT), \
+        PORT_IMAGE_REG(PORT_IMAGE_AMSEL, ID, VARIANT), \
+        PORT_IMAGE_REG(PORT_IMAGE_AFSEL, ID, VARIANT), \
+        PORT_IMAGE_REG(PORT_IMAGE_PCTL, ID, VARIANT), \
+        PORT_IMAGE_REG(PORT_IMAGE_DEN, ID, VARIANT), \
+        0U, \
+        PORT_IMAGE_REG(PORT_IMAGE_IBE, ID, VARIANT), \
+        PORT_IMAGE_REG(PORT_IMAGE_IEV, ID, VARIANT), \
+        PORT_IMAGE_REG(PORT_IMAGE_IM, ID, VARIANT) \
+    }
+
+/* FLAG in-case register REG of port ID differs between variants FROM and TO */
+#define PORT_DELTA_REG(REG, ID, FROM, TO, FLAG) \
+    ((PORT_IMAGE_REG(REG, ID, FROM) != PORT_IMAGE_REG(REG, ID, TO)) ? (FLAG) : 0U)
+
+/* Registers of port ID written to switch from variant FROM to variant TO,
+ * GPIODATA is also written when the direction changes so the new output pins drive their initial level */
+#define PORT_DELTA(ID, FROM, TO) \
+    (uint16)(PORT_DELTA_REG(PORT_IMAGE_DIR, ID, FROM, TO, PORT_IMAGE_REG_DIR | PORT_IMAGE_REG_DATA) | \
+             PORT_DELTA_REG(PORT_IMAGE_DATA, ID, FROM, TO, PORT_IMAGE_REG_DATA) | \
+             PORT_DELTA_REG(PORT_IMAGE_PUR, ID, FROM, TO, PORT_IMAGE_REG_PUR) | \
+             PORT_DELTA_REG(PORT_IMAGE_PDR, ID, FROM, TO, PORT_IMAGE_REG_PDR) | \
+             PORT_DELTA_REG(PORT_IMAGE_AMSEL, ID, FROM, TO, PORT_IMAGE_REG_AMSEL) | \
+             PORT_DELTA_REG(PORT_IMAGE_AFSEL, ID, FROM, TO, PORT_IMAGE_REG_AFSEL) | \
+             PORT_DELTA_REG(PORT_IMAGE_PCTL, ID, FROM, TO, PORT_IMAGE_REG_PCTL) | \
+             PORT_DELTA_REG(PORT_IMAGE_DEN, ID, FROM, TO, PORT_IMAGE_REG_DEN) | \
+             PORT_DELTA_REG(PORT_IMAGE_IBE, ID, FROM, TO, PORT_IMAGE_REG_INT) | \
+             PORT_DELTA_REG(PORT_IMAGE_IEV, ID, FROM, TO, PORT_IMAGE_REG_INT) | \
+             PORT_DELTA_REG(PORT_IMAGE_IM, ID, FROM, TO, PORT_IMAGE_REG_INT))
+
+/* Registers of each port written to switch from variant FROM to variant TO */
+#define PORT_DELTA_PORTS(FROM, TO) \
+    { \
+        PORT_DELTA(PORT_PORTA_ID, FROM, TO), \
+        PORT_DELTA(PORT_PORTB_ID, FROM, TO), \
+        PORT_DELTA(PORT_PORTC_ID, FROM, TO), \
+        PORT_DELTA(PORT_PORTD_ID, FROM, TO), \
+        PORT_DELTA(PORT_PORTE_ID, FROM, TO), \
+        PORT_DELTA(PORT_PORTF_ID, FROM, TO) \
+    }
+
+/* PB structure of variant VARIANT */
+#define PORT_CONFIGURATION(VARIANT) \
+    { \
+        VARIANT, \
+        { \
+            PORT_CONFIGURED_PINS_TABLE(PORT_PIN_ENTRY, PORT_PORTA_ID, VARIANT) \
+        }, \
+        { \
+            PORT_IMAGE(PORT_PORTA_ID, VARIANT), \
+            PORT_IMAGE(PORT_PORTB_ID, VARIANT), \
+            PORT_IMAGE(PORT_PORTC_ID, VARIANT), \
+            PORT_IMAGE(PORT_PORTD_ID, VARIANT), \
+            PORT_IMAGE(PORT_PORTE_ID, VARIANT), \
+            PORT_IMAGE(PORT_PORTF_ID, VARIANT) \
+        }, \
+        { \
+            PORT_DELTA_PORTS(PORT_VARIANT_NORMAL, VARIANT), \
+            PORT_DELTA_PORTS(PORT_VARIANT_DIAGNOSTIC, VARIANT), \
+            PORT_DELTA_PORTS(PORT_VARIANT_LIMP_HOME, VARIANT) \
+        } \
+    }
+
 /* PB structure used with Port_Init API */
-const Port_ConfigType Port_Configuration =
+const Port_ConfigType Port_Configuration = PORT_CONFIGURATION(PORT_VARIANT_NORMAL);
+
+/* PB structures of the diagnostic and limp-home variants used with Port_Init or Port_SwitchVariant APIs */
+const Port_ConfigType Port_Configuration_Diagnostic = PORT_CONFIGURATION(PORT_VARIANT_DIAGNOSTIC);
+const Port_ConfigType Port_Configuration_LimpHome = PORT_CONFIGURATION(PORT_VARIANT_LIMP_HOME);
+
+/* PB structures of all the variants indexed by the variant ID */
+const Port_ConfigType * const Port_Variants[PORT_NUMBER_OF_VARIANTS] =
 {
- PORT_PORTA_ID, PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTA_ID, PORT_PIN1_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTA_ID, PORT_PIN2_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTA_ID, PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTA_ID, PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTA_ID, PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTA_ID, PORT_PIN6_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTA_ID, PORT_PIN7_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-
- PORT_PORTB_ID, PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTB_ID, PORT_PIN1_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTB_ID, PORT_PIN2_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTB_ID, PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTB_ID, PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTB_ID, PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTB_ID, PORT_PIN6_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTB_ID, PORT_PIN7_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-// PORT_PORTC_ID, PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-// PORT_PORTC_ID, PORT_PIN1_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-// PORT_PORTC_ID, PORT_PIN2_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-// PORT_PORTC_ID, PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTC_ID, PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTC_ID, PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTC_ID, PORT_PIN6_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTC_ID, PORT_PIN7_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTD_ID, PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTD_ID, PORT_PIN1_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTD_ID, PORT_PIN2_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTD_ID, PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTD_ID, PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTD_ID, PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTD_ID, PORT_PIN6_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTD_ID, PORT_PIN7_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTE_ID, PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTE_ID, PORT_PIN1_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTE_ID, PORT_PIN2_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTE_ID, PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTE_ID, PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTE_ID, PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTF_ID, PORT_PIN0_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTF_ID, PORT_PIN1_ID, PORT_PIN_OUT, OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTF_ID, PORT_PIN2_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTF_ID, PORT_PIN3_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
- PORT_PORTF_ID, PORT_PIN4_ID, PORT_PIN_IN,  PULL_UP, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
+    &Port_Configuration,
+    &Port_Configuration_Diagnostic,
+    &Port_Configuration_LimpHome
 };
-
-// JTAG Pin configuration --> PORT C PINS 0 to 3
@@ -21,6 +21,12 @@
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
 #define PORT_DIR_REG_OFFSET               0x400
+#define PORT_INT_SENSE_REG_OFFSET         0x404
+#define PORT_INT_BOTH_EDGES_REG_OFFSET    0x408
+#define PORT_INT_EVENT_REG_OFFSET         0x40C
+#define PORT_INT_MASK_REG_OFFSET          0x410
+#define PORT_MASKED_INT_STATUS_REG_OFFSET 0x418
+#define PORT_INT_CLEAR_REG_OFFSET         0x41C
 #define PORT_ALT_FUNC_REG_OFFSET          0x420
 #define PORT_PULL_UP_REG_OFFSET           0x510
 #define PORT_PULL_DOWN_REG_OFFSET         0x514
@@ -30,5 +36,97 @@
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
 
+/* GPIOLOCK values ... any value other than the key locks GPIOCR again */
+#define PORT_LOCK_KEY                     0x4C4F434B
+#define PORT_LOCK_RELOCK                  0x00000000
+
+/* Pins whose GPIOCR bit is cleared at reset (JTAG pins PC0-PC3 and NMI pins PD7, PF0) */
+#define PORT_PORTC_LOCKED_PINS            0x0F
+#define PORT_PORTD_LOCKED_PINS            0x80
+#define PORT_PORTF_LOCKED_PINS            0x01
+
+/*
+ * GPIOPCTL value of each peripheral mode for the 8 pins of a port, one nibble per pin (pin 7 is the
+ * highest nibble), a zero nibble means the mode is not available on this pin.
+ * CAN --> CANnRx/CANnTx, GPT and ICU --> timer CCP pins, LIN --> UART Rx/Tx, PWM --> MnPWMx outputs, SPI --> SSI pins
+ */
+#define PORT_PORTA_PCTL_CAN               0x00000088    /* PA0-PA1 CAN1 */
+#define PORT_PORTA_PCTL_GPT               0x00000000
+#define PORT_PORTA_PCTL_ICU               0x00000000
+#define PORT_PORTA_PCTL_LIN               0x00000011    /* PA0-PA1 U0 */
+#define PORT_PORTA_PCTL_PWM               0x55000000    /* PA6-PA7 M1PWM2-3 */
+#define PORT_PORTA_PCTL_SPI               0x00222200    /* PA2-PA5 SSI0 */
+
+#define PORT_PORTB_PCTL_CAN               0x00880000    /* PB4-PB5 CAN0 */
+#define PORT_PORTB_PCTL_GPT               0x77777777    /* PB0-PB7 T0-T3 CCP */
+#define PORT_PORTB_PCTL_ICU               0x77777777
+#define PORT_PORTB_PCTL_LIN               0x00000011    /* PB0-PB1 U1 */
+#define PORT_PORTB_PCTL_PWM               0x44440000    /* PB4-PB7 M0PWM0-3 */
+#define PORT_PORTB_PCTL_SPI               0x22220000    /* PB4-PB7 SSI2 */
+
+#define PORT_PORTC_PCTL_CAN               0x00000000
+#define PORT_PORTC_PCTL_GPT               0x77777777    /* PC0-PC3 T4-T5 CCP, PC4-PC7 WT0-WT1 CCP */
+#define PORT_PORTC_PCTL_ICU               0x77777777
+#define PORT_PORTC_PCTL_LIN               0x11110000    /* PC4-PC5 U4, PC6-PC7 U3 */
+#define PORT_PORTC_PCTL_PWM               0x00440000    /* PC4-PC5 M0PWM6-7 */
+#define PORT_PORTC_PCTL_SPI               0x00000000
+
+#define PORT_PORTD_PCTL_CAN               0x00000000
+#define PORT_PORTD_PCTL_GPT               0x77777777    /* PD0-PD7 WT2-WT5 CCP */
+#define PORT_PORTD_PCTL_ICU               0x77777777
+#define PORT_PORTD_PCTL_LIN               0x11110000    /* PD4-PD5 U6, PD6-PD7 U2 */
+#define PORT_PORTD_PCTL_PWM               0x00000044    /* PD0-PD1 M0PWM6-7 */
+#define PORT_PORTD_PCTL_SPI               0x00002222    /* PD0-PD3 SSI1 */
+
+#define PORT_PORTE_PCTL_CAN               0x00880000    /* PE4-PE5 CAN0 */
+#define PORT_PORTE_PCTL_GPT               0x00000000
+#define PORT_PORTE_PCTL_ICU               0x00000000
+#define PORT_PORTE_PCTL_LIN               0x00110011    /* PE0-PE1 U7, PE4-PE5 U5 */
+#define PORT_PORTE_PCTL_PWM               0x00440000    /* PE4-PE5 M0PWM4-5 */
+#define PORT_PORTE_PCTL_SPI               0x00000000
+
+#define PORT_PORTF_PCTL_CAN               0x00003003    /* PF0, PF3 CAN0 */
+#define PORT_PORTF_PCTL_GPT               0x00077777    /* PF0-PF4 T0-T2 CCP */
+#define PORT_PORTF_PCTL_ICU               0x00077777
+#define PORT_PORTF_PCTL_LIN               0x00000000
+#define PORT_PORTF_PCTL_PWM               0x00005555    /* PF0-PF3 M1PWM4-7 */
+#define PORT_PORTF_PCTL_SPI               0x00002222    /* PF0-PF3 SSI1 */
+
+/* Pins of each port with an analog function (AINx or analog comparator inputs) */
+#define PORT_PORTA_ANALOG_PINS            0x00
+#define PORT_PORTB_ANALOG_PINS            0x30          /* PB4-PB5 AIN10-11 */
+#define PORT_PORTC_ANALOG_PINS            0xF0          /* PC4-PC7 C0/C1 inputs */
+#define PORT_PORTD_ANALOG_PINS            0x0F          /* PD0-PD3 AIN4-7 */
+#define PORT_PORTE_ANALOG_PINS            0x3F          /* PE0-PE5 AIN0-3, AIN8-9 */
+#define PORT_PORTF_ANALOG_PINS            0x00
+
+/* Value of the port PORT from the values of the six ports */
+#define PORT_SELECT(PORT, A, B, C, D, E, F) \
+    (((PORT) == PORT_PORTA_ID) ? (A) : ((PORT) == PORT_PORTB_ID) ? (B) : ((PORT) == PORT_PORTC_ID) ? (C) : \
+     ((PORT) == PORT_PORTD_ID) ? (D) : ((PORT) == PORT_PORTE_ID) ? (E) : (F))
+
+#define PORT_PCTL_PORT(PORT, FUNC) \
+    PORT_SELECT(PORT, PORT_PORTA_PCTL_##FUNC, PORT_PORTB_PCTL_##FUNC, PORT_PORTC_PCTL_##FUNC, \
+                      PORT_PORTD_PCTL_##FUNC, PORT_PORTE_PCTL_##FUNC, PORT_PORTF_PCTL_##FUNC)
+
+#define PORT_ANALOG_PINS(PORT) \
+    PORT_SELECT(PORT, PORT_PORTA_ANALOG_PINS, PORT_PORTB_ANALOG_PINS, PORT_PORTC_ANALOG_PINS, \
+                      PORT_PORTD_ANALOG_PINS, PORT_PORTE_ANALOG_PINS, PORT_PORTF_ANALOG_PINS)
+
+/* GPIOPCTL value of the mode MODE for the 8 pins of the port PORT, zero for DIO, ADC and the modes with no pins */
+#define PORT_PCTL_MODE(PORT, MODE) \
+    ((uint32)(((MODE) == PORT_PIN_MODE_CAN)     ? PORT_PCTL_PORT(PORT, CAN) : \
+              ((MODE) == PORT_PIN_MODE_DIO_GPT) ? PORT_PCTL_PORT(PORT, GPT) : \
+              ((MODE) == PORT_PIN_MODE_ICU)     ? PORT_PCTL_PORT(PORT, ICU) : \
+              ((MODE) == PORT_PIN_MODE_LIN)     ? PORT_PCTL_PORT(PORT, LIN) : \
+              ((MODE) == PORT_PIN_MODE_PWM)     ? PORT_PCTL_PORT(PORT, PWM) : \
+              ((MODE) == PORT_PIN_MODE_SPI)     ? PORT_PCTL_PORT(PORT, SPI) : 0U))
+
+/* In-case the mode MODE can be used on pin PIN of port PORT */
+#define PORT_PIN_MODE_IS_AVAILABLE(PORT, PIN, MODE) \
+    (((MODE) == PORT_PIN_MODE_DIO) || \
+     (((MODE) == PORT_PIN_MODE_ADC) && (((PORT_ANALOG_PINS(PORT) >> (PIN)) & 1U) != 0U)) || \
+     (((PORT_PCTL_MODE(PORT, MODE) >> ((PIN) * 4U)) & 0x0000000FU) != 0U))
+
 
 #endif /* PORT_REGS_H_ */
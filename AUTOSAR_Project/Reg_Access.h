@@ -0,0 +1,43 @@
+ /******************************************************************************
+ *
+ * Module: Common - Register Access
+ *
+ * File Name: Reg_Access.h
+ *
+ * Description: Abstraction of the peripheral register accesses of the drivers.
+ *              On the target a register is the volatile word at its address,
+ *              a host build defines REG_ACCESS_SIMULATION and every access is
+ *              routed to the register model of the host directory.
+ *
+ * Author: Salma Hamdy
+ *
+ *******************************************************************************/
+
+#ifndef REG_ACCESS_H
+#define REG_ACCESS_H
+
+#include "Std_Types.h"
+
+#ifdef REG_ACCESS_SIMULATION
+
+/* Register model of the host build (host/Reg_Sim.c) */
+extern uint32 Reg_SimRead(uint32 Address);
+extern void Reg_SimWrite(uint32 Address, uint32 Value);
+
+/* Read the register at ADDRESS */
+#define REG_READ(ADDRESS)             Reg_SimRead((uint32)(ADDRESS))
+
+/* Write VALUE into the register at ADDRESS */
+#define REG_WRITE(ADDRESS, VALUE)     Reg_SimWrite((uint32)(ADDRESS), (uint32)(VALUE))
+
+#else
+
+/* Read the register at ADDRESS */
+#define REG_READ(ADDRESS)             (*((volatile uint32 *)(ADDRESS)))
+
+/* Write VALUE into the register at ADDRESS */
+#define REG_WRITE(ADDRESS, VALUE)     (*((volatile uint32 *)(ADDRESS)) = (uint32)(VALUE))
+
+#endif
+
+#endif /* REG_ACCESS_H */
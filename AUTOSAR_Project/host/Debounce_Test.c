@@ -0,0 +1,120 @@
+ /******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce_Test.c
+ *
+ * Description: Host test of the SW1 debouncing through the Button module on the
+ *              register model: a press and a release, a glitch shorter than the
+ *              threshold, an edge while the counter is running and the edge
+ *              gating of Debounce_MainFunction.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Reg_Sim.h"
+#include "Det_Sim.h"
+#include "Mcu.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Debounce.h"
+#include "Button.h"
+
+uint32 Test_Failures = 0U;
+
+/* Address of the GPIODATA register of SW1 port */
+#define TEST_SW1_DATA_REG         REG_SIM_GPIO_ADDRESS(DioConf_SW1_PORT_NUM, REG_SIM_GPIO_DATA_OFFSET)
+
+/* Threshold of SW1 in the debounced inputs table */
+#define TEST_SW1_THRESHOLD        (3U)
+
+/* Drive SW1 to Level and raise its edge notification as the port F interrupt does */
+STATIC void Test_SetButton(uint8 Level)
+{
+    Reg_SimSetInput(DioConf_SW1_PORT_NUM, DioConf_SW1_CHANNEL_NUM, Level);
+    Button_EdgeNotification();
+}
+
+/* Run Debounce_MainFunction Count times */
+STATIC void Test_RunDebounce(uint8 Count)
+{
+    uint8 index;
+
+    for(index = 0U; index < Count; index++)
+    {
+        Debounce_MainFunction();
+    }
+}
+
+int main(void)
+{
+    /* SW1 is released (pulled up) when the module reads its initial state */
+    Reg_SimReset();
+    Det_SimClear();
+    Mcu_Init();
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    Reg_SimSetInput(DioConf_SW1_PORT_NUM, DioConf_SW1_CHANNEL_NUM, STD_HIGH);
+    Debounce_Init();
+    TEST_CHECK(BUTTON_RELEASED == Button_GetState());
+
+    /* No edge and no running counter ... the port is not read */
+    Reg_SimClearCounters();
+    Test_RunDebounce(5U);
+    TEST_CHECK(0U == Reg_SimGetReadCount(TEST_SW1_DATA_REG));
+
+    /* A level change without its edge notification is not seen either */
+    Reg_SimSetInput(DioConf_SW1_PORT_NUM, DioConf_SW1_CHANNEL_NUM, STD_LOW);
+    Test_RunDebounce(5U);
+    TEST_CHECK(BUTTON_RELEASED == Button_GetState());
+    TEST_CHECK(0U == Reg_SimGetReadCount(TEST_SW1_DATA_REG));
+
+    /* Press ... the state changes at the threshold sample, the running counter keeps the port sampled */
+    Test_SetButton(STD_LOW);
+    Test_RunDebounce(TEST_SW1_THRESHOLD - 1U);
+    TEST_CHECK(BUTTON_RELEASED == Button_GetState());
+    Test_RunDebounce(1U);
+    TEST_CHECK(BUTTON_PRESSED == Button_GetState());
+    TEST_CHECK(TEST_SW1_THRESHOLD == Reg_SimGetReadCount(TEST_SW1_DATA_REG));
+
+    /* Stable again ... back to no reads */
+    Reg_SimClearCounters();
+    Test_RunDebounce(5U);
+    TEST_CHECK(0U == Reg_SimGetReadCount(TEST_SW1_DATA_REG));
+
+    /* A glitch shorter than the threshold clears the counter and does not change the state */
+    Test_SetButton(STD_HIGH);
+    Test_RunDebounce(TEST_SW1_THRESHOLD - 1U);
+    Test_SetButton(STD_LOW);
+    Test_RunDebounce(1U);
+    TEST_CHECK(BUTTON_PRESSED == Button_GetState());
+    Test_RunDebounce(5U);
+    TEST_CHECK(BUTTON_PRESSED == Button_GetState());
+
+    /* Release with a bounce edge while counting ... the pending edge does not restart the counter */
+    Test_SetButton(STD_HIGH);
+    Test_RunDebounce(1U);
+    Button_EdgeNotification();
+    Test_RunDebounce(TEST_SW1_THRESHOLD - 2U);
+    TEST_CHECK(BUTTON_PRESSED == Button_GetState());
+    Test_RunDebounce(1U);
+    TEST_CHECK(BUTTON_RELEASED == Button_GetState());
+
+    /* A bounce back to the old level in the middle of the count restarts it */
+    Test_SetButton(STD_LOW);
+    Test_RunDebounce(1U);
+    Test_SetButton(STD_HIGH);
+    Test_RunDebounce(1U);
+    Test_SetButton(STD_LOW);
+    Test_RunDebounce(TEST_SW1_THRESHOLD - 1U);
+    TEST_CHECK(BUTTON_RELEASED == Button_GetState());
+    Test_RunDebounce(1U);
+    TEST_CHECK(BUTTON_PRESSED == Button_GetState());
+
+    TEST_CHECK(0U == Det_SimErrorCount);
+    TEST_CHECK(0U == Reg_SimGetFaultCount());
+
+    printf("Debounce_Test: %s (%u failed checks)\n", (0U == Test_Failures) ? "PASS" : "FAIL", (unsigned)Test_Failures);
+    return (0U == Test_Failures) ? 0 : 1;
+}
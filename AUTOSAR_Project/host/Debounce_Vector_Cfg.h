@@ -0,0 +1,46 @@
+ /******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce_Vector_Cfg.h
+ *
+ * Description: Debounce configuration of Debounce_Vector_Test, forced in place of
+ *              Debounce_Cfg.h (same include guard) when Debounce.c is built for it:
+ *              inputs with the thresholds 1, 3 and 7 in port B and in port F.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#ifndef DEBOUNCE_CFG_H_
+#define DEBOUNCE_CFG_H_
+
+/* Number of the debounced inputs */
+#define DEBOUNCE_CONFIGURED_INPUTS          (5U)
+
+/* Input Index in the debounced inputs table */
+#define DebounceConf_PB0_INPUT_ID_INDEX     (uint8)0x00
+#define DebounceConf_PB1_INPUT_ID_INDEX     (uint8)0x01
+#define DebounceConf_PB2_INPUT_ID_INDEX     (uint8)0x02
+#define DebounceConf_PF0_INPUT_ID_INDEX     (uint8)0x03
+#define DebounceConf_SW1_INPUT_ID_INDEX     (uint8)0x04
+
+/* Dio port of the port B inputs */
+#define DebounceConf_PORTB_NUM              (Dio_PortType)1 /* PORTB */
+
+/* Largest threshold of the 3-bit counter of each input */
+#define DEBOUNCE_MAX_THRESHOLD              (7U)
+
+/*
+ * Debounced inputs, each entry is:
+ * DEBOUNCE_INPUT(PORT_ID, Port,                  Pin,                      Threshold, Edge)
+ *
+ * Port F mixes an edge input and a polled one so it is sampled at every call.
+ */
+#define DEBOUNCE_CONFIGURED_INPUTS_TABLE(DEBOUNCE_INPUT, PORT_ID) \
+    DEBOUNCE_INPUT(PORT_ID, DebounceConf_PORTB_NUM, 0U,                       1U,        STD_OFF) \
+    DEBOUNCE_INPUT(PORT_ID, DebounceConf_PORTB_NUM, 1U,                       3U,        STD_OFF) \
+    DEBOUNCE_INPUT(PORT_ID, DebounceConf_PORTB_NUM, 2U,                       7U,        STD_OFF) \
+    DEBOUNCE_INPUT(PORT_ID, DioConf_SW1_PORT_NUM,   0U,                       1U,        STD_OFF) \
+    DEBOUNCE_INPUT(PORT_ID, DioConf_SW1_PORT_NUM,   DioConf_SW1_CHANNEL_NUM,  7U,        STD_ON)
+
+#endif /* DEBOUNCE_CFG_H_ */
@@ -0,0 +1,110 @@
+ /******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce_Vector_Test.c
+ *
+ * Description: Host test of the vertical counters of Debounce_MainFunction with the
+ *              inputs of Debounce_Vector_Cfg.h: each input of port B and port F
+ *              changes its state at its own threshold (1, 3 or 7 samples) and a
+ *              glitch on one input only restarts its own counter.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Reg_Sim.h"
+#include "Det_Sim.h"
+#include "Mcu.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Debounce.h"
+
+uint32 Test_Failures = 0U;
+
+#ifndef DebounceConf_PB0_INPUT_ID_INDEX
+#error "Debounce_Vector_Test has to be built with Debounce_Vector_Cfg.h in place of Debounce_Cfg.h"
+#endif
+
+/* Debounced pins of port B (PB0, PB1, PB2) and port F (PF0, SW1) */
+#define TEST_PORTB_INPUTS         (0x07U)
+#define TEST_PORTF_INPUTS         (0x11U)
+
+/* Drive the levels of the debounced pins of port B and port F, one bit per pin */
+STATIC void Test_SetInputs(uint8 PortB_Levels, uint8 PortF_Levels)
+{
+    uint8 pin;
+
+    for(pin = 0U; pin < 8U; pin++)
+    {
+        if(0U != (TEST_PORTB_INPUTS & (1U << pin)))
+        {
+            Reg_SimSetInput(DebounceConf_PORTB_NUM, pin, (0U != (PortB_Levels & (1U << pin))) ? STD_HIGH : STD_LOW);
+        }
+        if(0U != (TEST_PORTF_INPUTS & (1U << pin)))
+        {
+            Reg_SimSetInput(DioConf_SW1_PORT_NUM, pin, (0U != (PortF_Levels & (1U << pin))) ? STD_HIGH : STD_LOW);
+        }
+    }
+}
+
+int main(void)
+{
+    /* Debounced states of port B and port F after each sample of a falling change of all the inputs */
+    STATIC const uint8 Test_PortB_Falling[7] = {0x06U, 0x06U, 0x04U, 0x04U, 0x04U, 0x04U, 0x00U};
+    STATIC const uint8 Test_PortF_Falling[7] = {0x10U, 0x10U, 0x10U, 0x10U, 0x10U, 0x10U, 0x00U};
+    uint8 sample;
+
+    Reg_SimReset();
+    Det_SimClear();
+    Mcu_Init();
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    Test_SetInputs(0xFFU, 0xFFU);
+    Debounce_Init();
+    TEST_CHECK(TEST_PORTB_INPUTS == Debounce_GetPortState(DebounceConf_PORTB_NUM));
+    TEST_CHECK(TEST_PORTF_INPUTS == Debounce_GetPortState(DioConf_SW1_PORT_NUM));
+
+    /* All the inputs fall together ... each one follows at its own threshold */
+    Test_SetInputs(0x00U, 0x00U);
+    Debounce_EdgeNotification(DioConf_SW1_PORT_NUM);
+    for(sample = 0U; sample < 7U; sample++)
+    {
+        Debounce_MainFunction();
+        TEST_CHECK(Test_PortB_Falling[sample] == Debounce_GetPortState(DebounceConf_PORTB_NUM));
+        TEST_CHECK(Test_PortF_Falling[sample] == Debounce_GetPortState(DioConf_SW1_PORT_NUM));
+    }
+
+    /* All the inputs rise, PB2 glitches back low after 4 samples ... only its counter restarts */
+    Test_SetInputs(0xFFU, 0xFFU);
+    for(sample = 0U; sample < 4U; sample++)
+    {
+        Debounce_MainFunction();
+    }
+    TEST_CHECK(0x03U == Debounce_GetPortState(DebounceConf_PORTB_NUM));
+    Test_SetInputs(0xFBU, 0xFFU);
+    Debounce_MainFunction();
+    Test_SetInputs(0xFFU, 0xFFU);
+    for(sample = 0U; sample < 2U; sample++)
+    {
+        Debounce_MainFunction();
+    }
+    TEST_CHECK(STD_HIGH == Debounce_GetInputState(DebounceConf_SW1_INPUT_ID_INDEX));   /* 7 samples high */
+    TEST_CHECK(STD_LOW == Debounce_GetInputState(DebounceConf_PB2_INPUT_ID_INDEX));    /* 2 samples since the glitch */
+    for(sample = 0U; sample < 4U; sample++)
+    {
+        Debounce_MainFunction();
+    }
+    TEST_CHECK(STD_LOW == Debounce_GetInputState(DebounceConf_PB2_INPUT_ID_INDEX));
+    Debounce_MainFunction();
+    TEST_CHECK(STD_HIGH == Debounce_GetInputState(DebounceConf_PB2_INPUT_ID_INDEX));
+    TEST_CHECK(STD_HIGH == Debounce_GetInputState(DebounceConf_PB0_INPUT_ID_INDEX));
+    TEST_CHECK(STD_HIGH == Debounce_GetInputState(DebounceConf_PB1_INPUT_ID_INDEX));
+    TEST_CHECK(STD_HIGH == Debounce_GetInputState(DebounceConf_PF0_INPUT_ID_INDEX));
+
+    TEST_CHECK(0U == Det_SimErrorCount);
+    TEST_CHECK(0U == Reg_SimGetFaultCount());
+
+    printf("Debounce_Vector_Test: %s (%u failed checks)\n", (0U == Test_Failures) ? "PASS" : "FAIL", (unsigned)Test_Failures);
+    return (0U == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+ /******************************************************************************
+ *
+ * Module: Det_Sim
+ *
+ * File Name: Det_Sim.c
+ *
+ * Description: Det of the host build, it replaces Det.c which halts on the
+ *              first reported error.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#include "Det_Sim.h"
+
+uint32 Det_SimErrorCount = 0U;
+uint16 Det_SimLastModuleId = 0U;
+uint8 Det_SimLastApiId = 0U;
+uint8 Det_SimLastErrorId = 0U;
+
+Std_ReturnType Det_ReportError( uint16 ModuleId,
+                                uint8 InstanceId,
+                                uint8 ApiId,
+                                uint8 ErrorId )
+{
+    (void)InstanceId;
+    Det_SimErrorCount++;
+    Det_SimLastModuleId = ModuleId;
+    Det_SimLastApiId = ApiId;
+    Det_SimLastErrorId = ErrorId;
+    return E_OK;
+}
+
+void Det_SimClear(void)
+{
+    Det_SimErrorCount = 0U;
+    Det_SimLastModuleId = 0U;
+    Det_SimLastApiId = 0U;
+    Det_SimLastErrorId = 0U;
+}
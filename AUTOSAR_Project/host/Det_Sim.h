@@ -0,0 +1,27 @@
+ /******************************************************************************
+ *
+ * Module: Det_Sim
+ *
+ * File Name: Det_Sim.h
+ *
+ * Description: Header file for the Det of the host build, the reported errors
+ *              are recorded instead of halting so the tests can check them.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#ifndef DET_SIM_H
+#define DET_SIM_H
+
+#include "Det.h"
+
+/* Number of errors reported since the last Det_SimClear and the last reported error */
+extern uint32 Det_SimErrorCount;
+extern uint16 Det_SimLastModuleId;
+extern uint8 Det_SimLastApiId;
+extern uint8 Det_SimLastErrorId;
+
+/* Forget the reported errors */
+void Det_SimClear(void);
+
+#endif /* DET_SIM_H */
@@ -0,0 +1,32 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_PinUnpacked.h
+ *
+ * Description: Layout of Port_ConfigPin before it was packed into one 32-bit
+ *              word, used by the host decode test and the size report.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#ifndef PORT_PIN_UNPACKED_H
+#define PORT_PIN_UNPACKED_H
+
+#include "Port.h"
+
+/* One field per pin parameter, the enums take an int each */
+typedef struct
+{
+    uint8 port_num;
+    Port_PinType pin_num;
+    Port_PinDirectionType pin_direction;
+    Port_InternalResistorType pin_resistor;
+    Port_PinModeType pin_mode;
+    uint8 pin_direction_changeable;
+    uint8 pin_mode_changeable;
+    Port_PinLevelValueType pin_initial_value;
+    Port_PinEdgeType pin_edge;
+} Port_PinUnpackedType;
+
+#endif /* PORT_PIN_UNPACKED_H */
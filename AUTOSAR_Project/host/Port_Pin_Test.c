@@ -0,0 +1,65 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Pin_Test.c
+ *
+ * Description: Host test of the packed pins table, every entry of every variant
+ *              is decoded with the PORT_PIN_CFG_xxx accessors and compared with
+ *              the unpacked fields built from the same pins table row.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Port_PinUnpacked.h"
+
+/* The pins table macro is local to the configuration source */
+#include "Port_PBcfg.c"
+
+uint32 Test_Failures = 0U;
+
+/* Unpacked entry of one pins table row */
+#define PORT_PIN_UNPACKED_ENTRY(ID, PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE) \
+    {PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, LEVEL, EDGE},
+
+STATIC const Port_PinUnpackedType Test_UnpackedPins[PORT_NUMBER_OF_VARIANTS][PORT_CONFIGURED_PINS] =
+{
+    {PORT_CONFIGURED_PINS_TABLE(PORT_PIN_UNPACKED_ENTRY, PORT_PORTA_ID, PORT_VARIANT_NORMAL)},
+    {PORT_CONFIGURED_PINS_TABLE(PORT_PIN_UNPACKED_ENTRY, PORT_PORTA_ID, PORT_VARIANT_DIAGNOSTIC)},
+    {PORT_CONFIGURED_PINS_TABLE(PORT_PIN_UNPACKED_ENTRY, PORT_PORTA_ID, PORT_VARIANT_LIMP_HOME)}
+};
+
+int main(void)
+{
+    const Port_PinUnpackedType * expected;
+    Port_ConfigPin pin;
+    uint8 variant;
+    uint8 index;
+
+    TEST_CHECK(4U == sizeof(Port_ConfigPin));
+
+    for(variant = 0U; variant < PORT_NUMBER_OF_VARIANTS; variant++)
+    {
+        TEST_CHECK(variant == Port_Variants[variant]->VariantId);
+
+        for(index = 0U; index < PORT_CONFIGURED_PINS; index++)
+        {
+            pin = Port_Variants[variant]->Pin[index];
+            expected = &Test_UnpackedPins[variant][index];
+
+            TEST_CHECK(expected->port_num == PORT_PIN_CFG_PORT_NUM(pin));
+            TEST_CHECK(expected->pin_num == PORT_PIN_CFG_PIN_NUM(pin));
+            TEST_CHECK(expected->pin_direction == PORT_PIN_CFG_DIRECTION(pin));
+            TEST_CHECK(expected->pin_resistor == PORT_PIN_CFG_RESISTOR(pin));
+            TEST_CHECK(expected->pin_mode == PORT_PIN_CFG_MODE(pin));
+            TEST_CHECK(expected->pin_direction_changeable == PORT_PIN_CFG_DIRECTION_CHANGEABLE(pin));
+            TEST_CHECK(expected->pin_mode_changeable == PORT_PIN_CFG_MODE_CHANGEABLE(pin));
+            TEST_CHECK(expected->pin_initial_value == PORT_PIN_CFG_INITIAL_VALUE(pin));
+            TEST_CHECK(expected->pin_edge == PORT_PIN_CFG_EDGE(pin));
+        }
+    }
+
+    printf("Port_Pin_Test: %s (%u failed checks)\n", (0U == Test_Failures) ? "PASS" : "FAIL", (unsigned)Test_Failures);
+    return (0U == Test_Failures) ? 0 : 1;
+}
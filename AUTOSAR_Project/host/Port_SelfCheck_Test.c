@@ -0,0 +1,65 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_SelfCheck_Test.c
+ *
+ * Description: Host test of Port_Init built with PORT_IMAGE_SELF_CHECK ON, the
+ *              generated images of every variant pass the check and a port image
+ *              which does not match its pins is rejected before any register
+ *              is written.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Reg_Sim.h"
+#include "Det_Sim.h"
+#include "Mcu.h"
+#include "Port.h"
+
+uint32 Test_Failures = 0U;
+
+#if (PORT_IMAGE_SELF_CHECK != STD_ON)
+#error "Port_SelfCheck_Test has to be linked with Port.c built with PORT_IMAGE_SELF_CHECK ON"
+#endif
+
+/* Copy of the normal configuration with one wrong bit in the GPIOPUR image of port F */
+STATIC Port_ConfigType Test_BadConfiguration;
+
+int main(void)
+{
+    uint8 variant;
+
+    /* A wrong image is reported and the module stays uninitialized, no register is written */
+    Test_BadConfiguration = Port_Configuration;
+    Test_BadConfiguration.Port[PORT_PORTF_ID].pur ^= 0x10U;
+    Reg_SimReset();
+    Det_SimClear();
+    Mcu_Init();
+    Reg_SimClearCounters();
+    Port_Init(&Test_BadConfiguration);
+    TEST_CHECK(1U == Det_SimErrorCount);
+    TEST_CHECK(PORT_INIT_SID == Det_SimLastApiId);
+    TEST_CHECK(PORT_E_PARAM_CONFIG == Det_SimLastErrorId);
+    TEST_CHECK(0U == Reg_SimGetCountedRegisters());
+
+    Det_SimClear();
+    Port_RefreshPortDirection();
+    TEST_CHECK(PORT_E_UNINIT == Det_SimLastErrorId);
+
+    /* The generated images of every variant match their pins */
+    for(variant = 0U; variant < PORT_NUMBER_OF_VARIANTS; variant++)
+    {
+        Reg_SimReset();
+        Det_SimClear();
+        Mcu_Init();
+        Port_Init(Port_Variants[variant]);
+        TEST_CHECK(0U == Det_SimErrorCount);
+        TEST_CHECK(Port_Variants[variant]->Port[PORT_PORTF_ID].den ==
+                   Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PORT_PORTF_ID, REG_SIM_GPIO_DEN_OFFSET)));
+    }
+
+    printf("Port_SelfCheck_Test: %s (%u failed checks)\n", (0U == Test_Failures) ? "PASS" : "FAIL", (unsigned)Test_Failures);
+    return (0U == Test_Failures) ? 0 : 1;
+}
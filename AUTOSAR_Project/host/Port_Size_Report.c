@@ -0,0 +1,38 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Size_Report.c
+ *
+ * Description: Flash footprint of the Port post-build configuration on the host,
+ *              with the packed pins table compared to the unpacked layout.
+ *              The sizes are the ones of the target, uint32 and the enums
+ *              take 4 bytes on both.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "Port_PinUnpacked.h"
+
+int main(void)
+{
+    unsigned packedTable   = (unsigned)(sizeof(Port_ConfigPin) * PORT_CONFIGURED_PINS);
+    unsigned unpackedTable = (unsigned)(sizeof(Port_PinUnpackedType) * PORT_CONFIGURED_PINS);
+    unsigned images        = (unsigned)sizeof(((const Port_ConfigType *)0)->Port);
+    unsigned deltas        = (unsigned)sizeof(((const Port_ConfigType *)0)->Delta);
+    unsigned configuration = (unsigned)sizeof(Port_ConfigType);
+
+    printf("%-18s %5u bytes    unpacked %5u bytes\n", "Port_ConfigPin",
+           (unsigned)sizeof(Port_ConfigPin), (unsigned)sizeof(Port_PinUnpackedType));
+    printf("%-18s %5u bytes    unpacked %5u bytes    (%u pins)\n", "Pins table",
+           packedTable, unpackedTable, (unsigned)PORT_CONFIGURED_PINS);
+    printf("%-18s %5u bytes                            (%u ports)\n", "Port images", images, (unsigned)PORT_NUMBER_OF_PORTS);
+    printf("%-18s %5u bytes\n", "Variant deltas", deltas);
+    printf("%-18s %5u bytes    unpacked %5u bytes\n", "Port_ConfigType",
+           configuration, configuration - packedTable + unpackedTable);
+    printf("%-18s %5u bytes    unpacked %5u bytes    (%u variants)\n", "All variants",
+           configuration * PORT_NUMBER_OF_VARIANTS, (configuration - packedTable + unpackedTable) * PORT_NUMBER_OF_VARIANTS,
+           (unsigned)PORT_NUMBER_OF_VARIANTS);
+    return 0;
+}
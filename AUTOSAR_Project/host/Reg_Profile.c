@@ -0,0 +1,171 @@
+ /******************************************************************************
+ *
+ * Module: Reg_Profile
+ *
+ * File Name: Reg_Profile.c
+ *
+ * Description: Register access profiler of the Port and Dio APIs. Each API is
+ *              called once on the host register model and its reads and writes
+ *              are counted per register. The report is written as JSON and
+ *              the program fails in-case an API exceeds its budget in
+ *              Reg_Profile_Cfg.h.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "Reg_Sim.h"
+#include "Reg_Profile_Cfg.h"
+#include "Det_Sim.h"
+#include "Mcu.h"
+#include "Port.h"
+#include "Dio.h"
+
+/* Pin used for the Port_SetPinDirection and Port_SetPinMode calls (PA0, direction and mode changeable) */
+#define REG_PROFILE_PORT_PIN             ((Port_PinType)0)
+
+/* Profiled call and its budget */
+typedef struct
+{
+    const char * name;
+    void (*Run)(void);
+    boolean initialized;    /* Port and Dio are initialized before the call */
+    uint32 max_reads;
+    uint32 max_writes;
+} Reg_ProfileApiType;
+
+STATIC void Reg_ProfilePortInit(void)
+{
+    Port_Init(&Port_Configuration);
+}
+
+STATIC void Reg_ProfilePortSetPinDirection(void)
+{
+    Port_SetPinDirection(REG_PROFILE_PORT_PIN, PORT_PIN_OUT);
+}
+
+STATIC void Reg_ProfilePortSetPinMode(void)
+{
+    Port_SetPinMode(REG_PROFILE_PORT_PIN, PORT_PIN_MODE_LIN);
+}
+
+STATIC void Reg_ProfilePortRefreshPortDirection(void)
+{
+    Port_RefreshPortDirection();
+}
+
+STATIC void Reg_ProfileDioReadChannel(void)
+{
+    (void)Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+}
+
+STATIC void Reg_ProfileDioWriteChannel(void)
+{
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+}
+
+STATIC void Reg_ProfileDioFlipChannel(void)
+{
+    (void)Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+}
+
+STATIC const Reg_ProfileApiType Reg_ProfileApis[] =
+{
+    {"Port_Init",                 Reg_ProfilePortInit,                 FALSE,
+     REG_PROFILE_PORT_INIT_MAX_READS,                 REG_PROFILE_PORT_INIT_MAX_WRITES},
+    {"Port_SetPinDirection",      Reg_ProfilePortSetPinDirection,      TRUE,
+     REG_PROFILE_PORT_SET_PIN_DIRECTION_MAX_READS,    REG_PROFILE_PORT_SET_PIN_DIRECTION_MAX_WRITES},
+    {"Port_SetPinMode",           Reg_ProfilePortSetPinMode,           TRUE,
+     REG_PROFILE_PORT_SET_PIN_MODE_MAX_READS,         REG_PROFILE_PORT_SET_PIN_MODE_MAX_WRITES},
+    {"Port_RefreshPortDirection", Reg_ProfilePortRefreshPortDirection, TRUE,
+     REG_PROFILE_PORT_REFRESH_DIRECTION_MAX_READS,    REG_PROFILE_PORT_REFRESH_DIRECTION_MAX_WRITES},
+    {"Dio_ReadChannel",           Reg_ProfileDioReadChannel,           TRUE,
+     REG_PROFILE_DIO_READ_CHANNEL_MAX_READS,          REG_PROFILE_DIO_READ_CHANNEL_MAX_WRITES},
+    {"Dio_WriteChannel",          Reg_ProfileDioWriteChannel,          TRUE,
+     REG_PROFILE_DIO_WRITE_CHANNEL_MAX_READS,         REG_PROFILE_DIO_WRITE_CHANNEL_MAX_WRITES},
+    {"Dio_FlipChannel",           Reg_ProfileDioFlipChannel,           TRUE,
+     REG_PROFILE_DIO_FLIP_CHANNEL_MAX_READS,          REG_PROFILE_DIO_FLIP_CHANNEL_MAX_WRITES}
+};
+
+#define REG_PROFILE_NUMBER_OF_APIS    (sizeof(Reg_ProfileApis) / sizeof(Reg_ProfileApis[0]))
+
+/************************************************************************************
+ * Function Name: Reg_ProfileApi
+ * Description: Call one API on a freshly reset model, write its JSON entry and return
+ *              TRUE in-case its reads and writes are within the budget.
+ ************************************************************************************/
+STATIC boolean Reg_ProfileApi(const Reg_ProfileApiType * Api, FILE * Report, boolean Last)
+{
+    uint32 address, reads, writes;
+    uint32 totalReads = 0U;
+    uint32 totalWrites = 0U;
+    boolean withinBudget;
+    uint8 index;
+
+    Reg_SimReset();
+    Det_SimClear();
+    Mcu_Init();
+    if(TRUE == Api->initialized)
+    {
+        Port_Init(&Port_Configuration);
+        Dio_Init(&Dio_Configuration);
+    }
+    Reg_SimClearCounters();
+
+    Api->Run();
+
+    fprintf(Report, "    {\n      \"api\": \"%s\",\n      \"registers\": [", Api->name);
+    for(index = 0U; index < Reg_SimGetCountedRegisters(); index++)
+    {
+        Reg_SimGetCounter(index, &address, &reads, &writes);
+        totalReads += reads;
+        totalWrites += writes;
+        fprintf(Report, "%s\n        {\"register\": \"%s\", \"address\": \"0x%08X\", \"reads\": %u, \"writes\": %u}",
+                (0U == index) ? "" : ",", Reg_SimGetName(address), (unsigned)address, (unsigned)reads, (unsigned)writes);
+    }
+    withinBudget = ((totalReads <= Api->max_reads) && (totalWrites <= Api->max_writes) &&
+                    (0U == Det_SimErrorCount) && (0U == Reg_SimGetFaultCount())) ? TRUE : FALSE;
+    fprintf(Report, "\n      ],\n      \"reads\": %u,\n      \"writes\": %u,\n      \"budget_reads\": %u,\n      \"budget_writes\": %u,\n"
+                    "      \"det_errors\": %u,\n      \"bus_faults\": %u,\n      \"within_budget\": %s\n    }%s\n",
+            (unsigned)totalReads, (unsigned)totalWrites, (unsigned)Api->max_reads, (unsigned)Api->max_writes,
+            (unsigned)Det_SimErrorCount, (unsigned)Reg_SimGetFaultCount(), (TRUE == withinBudget) ? "true" : "false",
+            (TRUE == Last) ? "" : ",");
+
+    fprintf(stderr, "%-26s reads %3u/%-3u writes %3u/%-3u %s\n", Api->name, (unsigned)totalReads, (unsigned)Api->max_reads,
+           (unsigned)totalWrites, (unsigned)Api->max_writes, (TRUE == withinBudget) ? "OK" : "OVER BUDGET");
+    return withinBudget;
+}
+
+/* Usage: Reg_Profile [report.json] ... the report is written to the standard output by default */
+int main(int argc, char * argv[])
+{
+    FILE * report = stdout;
+    boolean withinBudget = TRUE;
+    uint8 index;
+
+    if(argc > 1)
+    {
+        report = fopen(argv[1], "w");
+        if(NULL == report)
+        {
+            perror(argv[1]);
+            return 2;
+        }
+    }
+
+    fprintf(report, "{\n  \"apis\": [\n");
+    for(index = 0U; index < REG_PROFILE_NUMBER_OF_APIS; index++)
+    {
+        if(FALSE == Reg_ProfileApi(&Reg_ProfileApis[index], report, (index == (REG_PROFILE_NUMBER_OF_APIS - 1U)) ? TRUE : FALSE))
+        {
+            withinBudget = FALSE;
+        }
+    }
+    fprintf(report, "  ],\n  \"within_budget\": %s\n}\n", (TRUE == withinBudget) ? "true" : "false");
+
+    if(stdout != report)
+    {
+        fclose(report);
+    }
+    return (TRUE == withinBudget) ? 0 : 1;
+}
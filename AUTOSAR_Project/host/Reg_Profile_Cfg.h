@@ -0,0 +1,67 @@
+ /******************************************************************************
+ *
+ * Module: Reg_Profile
+ *
+ * File Name: Reg_Profile_Cfg.h
+ *
+ * Description: Register access budget of each profiled API, the number of
+ *              register reads and writes one call is designed to issue on
+ *              Port_Configuration and Dio_Configuration. `make budget` fails
+ *              when a call exceeds them.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#ifndef REG_PROFILE_CFG_H
+#define REG_PROFILE_CFG_H
+
+/* Registers of the image of one port: GPIODIR, GPIODATA, GPIOPUR, GPIOPDR, GPIOAMSEL, GPIOAFSEL, GPIOPCTL and GPIODEN */
+#define REG_PROFILE_PORT_IMAGE_REGISTERS                 (8U)
+
+/* Ports of Port_Configuration ... all the ports A to F have configured pins */
+#define REG_PROFILE_CONFIGURED_PORTS                     (6U)
+
+/* Ports with pins out of Port_Configuration (C, E and F), their registers are read to keep those pins */
+#define REG_PROFILE_PARTIAL_PORTS                        (3U)
+
+/* Ports with a locked pin in Port_Configuration (PD7 and PF0), unlocked by a GPIOLOCK write, committed by one GPIOCR
+ * store and locked again by a GPIOLOCK write */
+#define REG_PROFILE_LOCKED_PORTS                         (2U)
+
+/* Ports with edge interrupt pins in Port_Configuration (PF4), only port F which is also a partial port */
+#define REG_PROFILE_EDGE_PORTS                           (1U)
+
+/* Port_Init ... one write per image register of each port, the GPIODATA write goes through the
+ * address mask of the configured pins so it is never read. An edge port masks GPIOIM, writes
+ * GPIOIS, GPIOIBE and GPIOIEV, clears GPIOICR, unmasks GPIOIM and enables its NVIC_EN0 bit,
+ * all but the GPIOICR and NVIC_EN0 writes read the register first to keep the other pins */
+#define REG_PROFILE_PORT_INIT_MAX_READS                  ((REG_PROFILE_PARTIAL_PORTS * (REG_PROFILE_PORT_IMAGE_REGISTERS - 1U)) + \
+                                                          (REG_PROFILE_EDGE_PORTS * 5U))
+#define REG_PROFILE_PORT_INIT_MAX_WRITES                 ((REG_PROFILE_CONFIGURED_PORTS * REG_PROFILE_PORT_IMAGE_REGISTERS) + \
+                                                          (REG_PROFILE_LOCKED_PORTS * 3U) + (REG_PROFILE_EDGE_PORTS * 7U))
+
+/* Port_SetPinDirection of one pin ... one read-modify-write of GPIODIR */
+#define REG_PROFILE_PORT_SET_PIN_DIRECTION_MAX_READS     (1U)
+#define REG_PROFILE_PORT_SET_PIN_DIRECTION_MAX_WRITES    (1U)
+
+/* Port_SetPinMode of one pin ... one read-modify-write of GPIOAMSEL, GPIOAFSEL, GPIOPCTL and GPIODEN */
+#define REG_PROFILE_PORT_SET_PIN_MODE_MAX_READS          (4U)
+#define REG_PROFILE_PORT_SET_PIN_MODE_MAX_WRITES         (4U)
+
+/* Port_RefreshPortDirection with no drifted pins ... one GPIODIR read per port */
+#define REG_PROFILE_PORT_REFRESH_DIRECTION_MAX_READS     (REG_PROFILE_CONFIGURED_PORTS)
+#define REG_PROFILE_PORT_REFRESH_DIRECTION_MAX_WRITES    (0U)
+
+/* Dio_ReadChannel of one channel ... one GPIODATA read */
+#define REG_PROFILE_DIO_READ_CHANNEL_MAX_READS           (1U)
+#define REG_PROFILE_DIO_READ_CHANNEL_MAX_WRITES          (0U)
+
+/* Dio_WriteChannel of one channel ... one store to the GPIODATA address masked by the channel pin */
+#define REG_PROFILE_DIO_WRITE_CHANNEL_MAX_READS          (0U)
+#define REG_PROFILE_DIO_WRITE_CHANNEL_MAX_WRITES         (1U)
+
+/* Dio_FlipChannel of one channel ... one GPIODATA read and the inverted level stored to the masked address */
+#define REG_PROFILE_DIO_FLIP_CHANNEL_MAX_READS           (1U)
+#define REG_PROFILE_DIO_FLIP_CHANNEL_MAX_WRITES          (1U)
+
+#endif /* REG_PROFILE_CFG_H */
@@ -0,0 +1,633 @@
+ /******************************************************************************
+ *
+ * Module: Reg_Sim
+ *
+ * File Name: Reg_Sim.c
+ *
+ * Description: Source file for the host model of the TM4C123GH6PM registers
+ *              used by the drivers. It keeps the TM4C semantics the drivers
+ *              rely on:
+ *              - GPIODATA is mapped on 256 addresses, the address bits [9:2] mask the access
+ *              - GPIOCR is writable only while GPIOLOCK is unlocked and it protects
+ *                GPIOAFSEL, GPIOPUR, GPIOPDR and GPIODEN of the locked pins
+ *              - GPIORIS/GPIOMIS and SYSCTL_PRGPIO are read-only, GPIOICR and NVIC_EN0 are write-1
+ *              - a GPIO port is accessible only when its RCGCGPIO clock bit is set
+ *              Every access is counted per register.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "Reg_Sim.h"
+#include "Common_Macros.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* GPIO registers of one port */
+typedef struct
+{
+    uint32 data;
+    uint32 dir;
+    uint32 is;
+    uint32 ibe;
+    uint32 iev;
+    uint32 im;
+    uint32 ris;
+    uint32 afsel;
+    uint32 pur;
+    uint32 pdr;
+    uint32 den;
+    uint32 locked;
+    uint32 cr;
+    uint32 amsel;
+    uint32 pctl;
+    uint32 input;   /* External level of the pins */
+} Reg_SimPortType;
+
+/* Access counters of one register */
+typedef struct
+{
+    uint32 address;
+    uint32 reads;
+    uint32 writes;
+} Reg_SimCounterType;
+
+/* Core and system registers of the model */
+typedef struct
+{
+    uint32 rcgcgpio;
+    uint32 systick_ctrl;
+    uint32 systick_reload;
+    uint32 systick_current;
+    uint32 nvic_en0;
+    uint32 intctrl;
+    uint32 pri3;
+    uint32 demcr;
+    uint32 dwt_ctrl;
+    uint32 dwt_cyccnt;
+} Reg_SimSystemType;
+
+/* Base address of each port indexed by the port ID */
+STATIC const uint32 Reg_SimPortBase[REG_SIM_NUMBER_OF_PORTS] =
+{
+    REG_SIM_GPIO_ADDRESS(0U, 0U),
+    REG_SIM_GPIO_ADDRESS(1U, 0U),
+    REG_SIM_GPIO_ADDRESS(2U, 0U),
+    REG_SIM_GPIO_ADDRESS(3U, 0U),
+    REG_SIM_GPIO_ADDRESS(4U, 0U),
+    REG_SIM_GPIO_ADDRESS(5U, 0U)
+};
+
+/* Pins of each port whose GPIOCR bit is cleared at reset: PC0-PC3 (JTAG), PD7 (NMI) and PF0 (NMI) */
+STATIC const uint32 Reg_SimLockedPins[REG_SIM_NUMBER_OF_PORTS] =
+{
+    0x00U, 0x00U, 0x0FU, 0x80U, 0x00U, 0x01U
+};
+
+/* Size of the register block of one port */
+#define REG_SIM_PORT_BLOCK_SIZE          (0x1000U)
+
+/* Reset values of the JTAG pins PC0-PC3: alternate function, pull-up and digital enable set, PMCx = 1 */
+#define REG_SIM_JTAG_PINS                (0x0FU)
+#define REG_SIM_JTAG_PCTL                (0x00001111U)
+
+/* Clock bits of the 6 ports in RCGCGPIO and PRGPIO */
+#define REG_SIM_GPIO_CLOCK_MASK          (0x3FU)
+
+STATIC Reg_SimPortType Reg_SimPorts[REG_SIM_NUMBER_OF_PORTS];
+STATIC Reg_SimSystemType Reg_SimSystem;
+STATIC Reg_SimCounterType Reg_SimCounters[REG_SIM_MAX_COUNTED_REGISTERS];
+STATIC uint8 Reg_SimCountedRegisters = 0U;
+STATIC uint32 Reg_SimFaults = 0U;
+
+/* Names of the GPIO registers by offset, the other offsets of the port block are not modelled */
+STATIC const struct
+{
+    uint32 offset;
+    const char * name;
+} Reg_SimGpioNames[] =
+{
+    {REG_SIM_GPIO_DATA_OFFSET,   "DATA"},
+    {REG_SIM_GPIO_DIR_OFFSET,    "DIR"},
+    {REG_SIM_GPIO_IS_OFFSET,     "IS"},
+    {REG_SIM_GPIO_IBE_OFFSET,    "IBE"},
+    {REG_SIM_GPIO_IEV_OFFSET,    "IEV"},
+    {REG_SIM_GPIO_IM_OFFSET,     "IM"},
+    {REG_SIM_GPIO_RIS_OFFSET,    "RIS"},
+    {REG_SIM_GPIO_MIS_OFFSET,    "MIS"},
+    {REG_SIM_GPIO_ICR_OFFSET,    "ICR"},
+    {REG_SIM_GPIO_AFSEL_OFFSET,  "AFSEL"},
+    {REG_SIM_GPIO_PUR_OFFSET,    "PUR"},
+    {REG_SIM_GPIO_PDR_OFFSET,    "PDR"},
+    {REG_SIM_GPIO_DEN_OFFSET,    "DEN"},
+    {REG_SIM_GPIO_LOCK_OFFSET,   "LOCK"},
+    {REG_SIM_GPIO_CR_OFFSET,     "CR"},
+    {REG_SIM_GPIO_AMSEL_OFFSET,  "AMSEL"},
+    {REG_SIM_GPIO_PCTL_OFFSET,   "PCTL"}
+};
+
+#define REG_SIM_NUMBER_OF_GPIO_REGS    (sizeof(Reg_SimGpioNames) / sizeof(Reg_SimGpioNames[0]))
+
+/* Port qualified names of the GPIO registers (e.g. "GPIOF_DIR"), built on the first Reg_SimGetName call */
+STATIC char Reg_SimGpioFullNames[REG_SIM_NUMBER_OF_PORTS][REG_SIM_NUMBER_OF_GPIO_REGS][16];
+
+/* Names of the core and system registers */
+STATIC const struct
+{
+    uint32 address;
+    const char * name;
+} Reg_SimSystemNames[] =
+{
+    {SYSCTL_RCGCGPIO_REG_ADDRESS,  "SYSCTL_RCGCGPIO"},
+    {SYSCTL_PRGPIO_REG_ADDRESS,    "SYSCTL_PRGPIO"},
+    {SYSTICK_CTRL_REG_ADDRESS,     "SYSTICK_CTRL"},
+    {SYSTICK_RELOAD_REG_ADDRESS,   "SYSTICK_RELOAD"},
+    {SYSTICK_CURRENT_REG_ADDRESS,  "SYSTICK_CURRENT"},
+    {NVIC_EN0_REG_ADDRESS,         "NVIC_EN0"},
+    {NVIC_SYSTEM_INTCTRL_ADDRESS,  "NVIC_SYSTEM_INTCTRL"},
+    {NVIC_SYSTEM_PRI3_REG_ADDRESS, "NVIC_SYSTEM_PRI3"},
+    {DEBUG_DEMCR_REG_ADDRESS,      "DEBUG_DEMCR"},
+    {DWT_CTRL_REG_ADDRESS,         "DWT_CTRL"},
+    {DWT_CYCCNT_REG_ADDRESS,       "DWT_CYCCNT"}
+};
+
+/************************************************************************************
+ * Function Name: Reg_SimPortIndex
+ * Description: Port ID of a GPIO address, REG_SIM_NUMBER_OF_PORTS if it is not a GPIO address.
+ ************************************************************************************/
+STATIC uint8 Reg_SimPortIndex(uint32 Address)
+{
+    uint8 portIndex;
+
+    for(portIndex = 0U; portIndex < REG_SIM_NUMBER_OF_PORTS; portIndex++)
+    {
+        if((Address - Reg_SimPortBase[portIndex]) < REG_SIM_PORT_BLOCK_SIZE)
+        {
+            break;
+        }
+    }
+    return portIndex;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimCounterAddress
+ * Description: Address an access is counted on, all the GPIODATA aliases are counted on GPIODATA.
+ ************************************************************************************/
+STATIC uint32 Reg_SimCounterAddress(uint32 Address)
+{
+    uint8 portIndex = Reg_SimPortIndex(Address);
+
+    if((portIndex < REG_SIM_NUMBER_OF_PORTS) && ((Address - Reg_SimPortBase[portIndex]) <= REG_SIM_GPIO_DATA_OFFSET))
+    {
+        Address = Reg_SimPortBase[portIndex] + REG_SIM_GPIO_DATA_OFFSET;
+    }
+    return Address;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimCounter
+ * Description: Counters of the register at Address, a new entry is taken on its first access
+ *              and an access that finds the table full is counted as a fault.
+ ************************************************************************************/
+STATIC Reg_SimCounterType * Reg_SimCounter(uint32 Address)
+{
+    Reg_SimCounterType * counter = NULL_PTR;
+    uint8 index;
+
+    Address = Reg_SimCounterAddress(Address);
+    for(index = 0U; index < Reg_SimCountedRegisters; index++)
+    {
+        if(Reg_SimCounters[index].address == Address)
+        {
+            counter = &Reg_SimCounters[index];
+            break;
+        }
+    }
+    if((NULL_PTR == counter) && (Reg_SimCountedRegisters < REG_SIM_MAX_COUNTED_REGISTERS))
+    {
+        counter = &Reg_SimCounters[Reg_SimCountedRegisters++];
+        counter->address = Address;
+        counter->reads = 0U;
+        counter->writes = 0U;
+    }
+    else if(NULL_PTR == counter)
+    {
+        Reg_SimFaults++;    /* The access can not be counted ... the counts of this run are not complete */
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return counter;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimPadLevel
+ * Description: Level of the pins of a port, output pins follow GPIODATA, input pins the external level.
+ ************************************************************************************/
+STATIC uint32 Reg_SimPadLevel(const Reg_SimPortType * Port)
+{
+    return ((Port->data & Port->dir) | (Port->input & ~Port->dir)) & 0xFFU;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimUpdateLevelInterrupts
+ * Description: The level sensitive pins (GPIOIS set) keep their GPIORIS bit while the pin is at the GPIOIEV level.
+ ************************************************************************************/
+STATIC void Reg_SimUpdateLevelInterrupts(Reg_SimPortType * Port)
+{
+    uint32 active = ~(Reg_SimPadLevel(Port) ^ Port->iev) & Port->is & 0xFFU;
+
+    Port->ris = (Port->ris & ~Port->is) | active;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimGpioRead
+ * Description: Read one register of a GPIO port.
+ ************************************************************************************/
+STATIC uint32 Reg_SimGpioRead(const Reg_SimPortType * Port, uint32 Offset)
+{
+    uint32 value = 0U;
+
+    if(Offset <= REG_SIM_GPIO_DATA_OFFSET)
+    {
+        /* The address bits [9:2] select the pins, the other pins are read as 0 */
+        value = Reg_SimPadLevel(Port) & Port->den & (Offset >> 2);
+    }
+    else
+    {
+        switch(Offset)
+        {
+            case REG_SIM_GPIO_DIR_OFFSET:     value = Port->dir;              break;
+            case REG_SIM_GPIO_IS_OFFSET:      value = Port->is;               break;
+            case REG_SIM_GPIO_IBE_OFFSET:     value = Port->ibe;              break;
+            case REG_SIM_GPIO_IEV_OFFSET:     value = Port->iev;              break;
+            case REG_SIM_GPIO_IM_OFFSET:      value = Port->im;               break;
+            case REG_SIM_GPIO_RIS_OFFSET:     value = Port->ris;              break;
+            case REG_SIM_GPIO_MIS_OFFSET:     value = Port->ris & Port->im;   break;
+            case REG_SIM_GPIO_AFSEL_OFFSET:   value = Port->afsel;            break;
+            case REG_SIM_GPIO_PUR_OFFSET:     value = Port->pur;              break;
+            case REG_SIM_GPIO_PDR_OFFSET:     value = Port->pdr;              break;
+            case REG_SIM_GPIO_DEN_OFFSET:     value = Port->den;              break;
+            case REG_SIM_GPIO_LOCK_OFFSET:    value = Port->locked;           break;
+            case REG_SIM_GPIO_CR_OFFSET:      value = Port->cr;               break;
+            case REG_SIM_GPIO_AMSEL_OFFSET:   value = Port->amsel;            break;
+            case REG_SIM_GPIO_PCTL_OFFSET:    value = Port->pctl;             break;
+            default:                          value = 0U;                     break;  /* GPIOICR reads as 0 */
+        }
+    }
+    return value;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimGpioWrite
+ * Description: Write one register of a GPIO port.
+ ************************************************************************************/
+STATIC void Reg_SimGpioWrite(Reg_SimPortType * Port, uint32 Offset, uint32 Value)
+{
+    /* GPIOLOCK takes the 32-bit key and GPIOPCTL has 4 bits per pin, the other registers have 1 bit per pin */
+    Value &= ((REG_SIM_GPIO_LOCK_OFFSET == Offset) || (REG_SIM_GPIO_PCTL_OFFSET == Offset)) ? 0xFFFFFFFFU : 0xFFU;
+
+    if(Offset <= REG_SIM_GPIO_DATA_OFFSET)
+    {
+        /* Only the pins selected by the address bits [9:2] are changed */
+        Port->data = (Port->data & ~(Offset >> 2)) | (Value & (Offset >> 2));
+    }
+    else
+    {
+        switch(Offset)
+        {
+            case REG_SIM_GPIO_DIR_OFFSET:     Port->dir = Value;      break;
+            case REG_SIM_GPIO_IS_OFFSET:      Port->is = Value;       break;
+            case REG_SIM_GPIO_IBE_OFFSET:     Port->ibe = Value;      break;
+            case REG_SIM_GPIO_IEV_OFFSET:     Port->iev = Value;      break;
+            case REG_SIM_GPIO_IM_OFFSET:      Port->im = Value;       break;
+            case REG_SIM_GPIO_ICR_OFFSET:     Port->ris &= ~Value;    break;
+            case REG_SIM_GPIO_AMSEL_OFFSET:   Port->amsel = Value;    break;
+            case REG_SIM_GPIO_PCTL_OFFSET:    Port->pctl = Value;     break;
+
+            /* The pins with a cleared GPIOCR bit keep their value in the protected registers */
+            case REG_SIM_GPIO_AFSEL_OFFSET:   Port->afsel = (Port->afsel & ~Port->cr) | (Value & Port->cr);  break;
+            case REG_SIM_GPIO_PUR_OFFSET:     Port->pur   = (Port->pur & ~Port->cr) | (Value & Port->cr);    break;
+            case REG_SIM_GPIO_PDR_OFFSET:     Port->pdr   = (Port->pdr & ~Port->cr) | (Value & Port->cr);    break;
+            case REG_SIM_GPIO_DEN_OFFSET:     Port->den   = (Port->den & ~Port->cr) | (Value & Port->cr);    break;
+
+            case REG_SIM_GPIO_LOCK_OFFSET:
+                Port->locked = (REG_SIM_GPIO_LOCK_KEY == Value) ? 0U : 1U;
+                break;
+            case REG_SIM_GPIO_CR_OFFSET:
+                if(0U == Port->locked)
+                {
+                    Port->cr = Value;
+                }
+                else
+                {
+                    /* GPIOCR is read-only while GPIOLOCK is locked */
+                }
+                break;
+            default:
+                Reg_SimFaults++;    /* GPIORIS, GPIOMIS or a register out of the model */
+                break;
+        }
+    }
+    Reg_SimUpdateLevelInterrupts(Port);
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimSystemRegister
+ * Description: Storage of a core or system register, NULL_PTR for the addresses out of the model.
+ ************************************************************************************/
+STATIC uint32 * Reg_SimSystemRegister(uint32 Address)
+{
+    uint32 * reg = NULL_PTR;
+
+    switch(Address)
+    {
+        case SYSCTL_RCGCGPIO_REG_ADDRESS:  reg = &Reg_SimSystem.rcgcgpio;          break;
+        case SYSTICK_CTRL_REG_ADDRESS:     reg = &Reg_SimSystem.systick_ctrl;      break;
+        case SYSTICK_RELOAD_REG_ADDRESS:   reg = &Reg_SimSystem.systick_reload;    break;
+        case SYSTICK_CURRENT_REG_ADDRESS:  reg = &Reg_SimSystem.systick_current;   break;
+        case NVIC_EN0_REG_ADDRESS:         reg = &Reg_SimSystem.nvic_en0;          break;
+        case NVIC_SYSTEM_INTCTRL_ADDRESS:  reg = &Reg_SimSystem.intctrl;           break;
+        case NVIC_SYSTEM_PRI3_REG_ADDRESS: reg = &Reg_SimSystem.pri3;              break;
+        case DEBUG_DEMCR_REG_ADDRESS:      reg = &Reg_SimSystem.demcr;             break;
+        case DWT_CTRL_REG_ADDRESS:         reg = &Reg_SimSystem.dwt_ctrl;          break;
+        case DWT_CYCCNT_REG_ADDRESS:       reg = &Reg_SimSystem.dwt_cyccnt;        break;
+        default:                                                                   break;
+    }
+    return reg;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimReset
+ * Description: Put all the registers in their reset state and clear the access counters.
+ ************************************************************************************/
+void Reg_SimReset(void)
+{
+    uint8 portIndex;
+    Reg_SimPortType * port;
+
+    for(portIndex = 0U; portIndex < REG_SIM_NUMBER_OF_PORTS; portIndex++)
+    {
+        port = &Reg_SimPorts[portIndex];
+        *port = (Reg_SimPortType){0U};
+        port->locked = 1U;
+        port->cr = 0xFFU & ~Reg_SimLockedPins[portIndex];
+    }
+
+    /* PC0-PC3 are the JTAG pins at reset */
+    Reg_SimPorts[2].afsel = REG_SIM_JTAG_PINS;
+    Reg_SimPorts[2].pur   = REG_SIM_JTAG_PINS;
+    Reg_SimPorts[2].den   = REG_SIM_JTAG_PINS;
+    Reg_SimPorts[2].pctl  = REG_SIM_JTAG_PCTL;
+
+    Reg_SimSystem = (Reg_SimSystemType){0U};
+    Reg_SimFaults = 0U;
+    Reg_SimClearCounters();
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimPeek
+ * Description: Value of a register without side effects and without counting the access.
+ ************************************************************************************/
+uint32 Reg_SimPeek(uint32 Address)
+{
+    uint8 portIndex = Reg_SimPortIndex(Address);
+    uint32 * reg = Reg_SimSystemRegister(Address);
+    uint32 value = 0U;
+
+    if(portIndex < REG_SIM_NUMBER_OF_PORTS)
+    {
+        value = Reg_SimGpioRead(&Reg_SimPorts[portIndex], Address - Reg_SimPortBase[portIndex]);
+    }
+    else if(SYSCTL_PRGPIO_REG_ADDRESS == Address)
+    {
+        value = Reg_SimSystem.rcgcgpio & REG_SIM_GPIO_CLOCK_MASK;   /* The ports are ready as soon as their clock is enabled */
+    }
+    else if(NULL_PTR != reg)
+    {
+        value = *reg;
+    }
+    else
+    {
+        /* Out of the model ... read as 0 */
+    }
+    return value;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimRead
+ * Description: Register read of the drivers (REG_READ).
+ ************************************************************************************/
+uint32 Reg_SimRead(uint32 Address)
+{
+    uint8 portIndex = Reg_SimPortIndex(Address);
+    Reg_SimCounterType * counter = Reg_SimCounter(Address);
+    uint32 value = 0U;
+
+    if(NULL_PTR != counter)
+    {
+        counter->reads++;
+    }
+
+    if((portIndex < REG_SIM_NUMBER_OF_PORTS) && !BIT_IS_SET(Reg_SimSystem.rcgcgpio, portIndex))
+    {
+        Reg_SimFaults++;    /* Bus fault on the target ... the port clock is gated */
+    }
+    else if((portIndex == REG_SIM_NUMBER_OF_PORTS) && (SYSCTL_PRGPIO_REG_ADDRESS != Address) && (NULL_PTR == Reg_SimSystemRegister(Address)))
+    {
+        Reg_SimFaults++;    /* Address out of the model */
+    }
+    else
+    {
+        value = Reg_SimPeek(Address);
+    }
+    return value;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimWrite
+ * Description: Register write of the drivers (REG_WRITE).
+ ************************************************************************************/
+void Reg_SimWrite(uint32 Address, uint32 Value)
+{
+    uint8 portIndex = Reg_SimPortIndex(Address);
+    Reg_SimCounterType * counter = Reg_SimCounter(Address);
+    uint32 * reg = Reg_SimSystemRegister(Address);
+
+    if(NULL_PTR != counter)
+    {
+        counter->writes++;
+    }
+
+    if(portIndex < REG_SIM_NUMBER_OF_PORTS)
+    {
+        if(BIT_IS_SET(Reg_SimSystem.rcgcgpio, portIndex))
+        {
+            Reg_SimGpioWrite(&Reg_SimPorts[portIndex], Address - Reg_SimPortBase[portIndex], Value);
+        }
+        else
+        {
+            Reg_SimFaults++;    /* Bus fault on the target ... the port clock is gated */
+        }
+    }
+    else if(NVIC_EN0_REG_ADDRESS == Address)
+    {
+        Reg_SimSystem.nvic_en0 |= Value;    /* Writing 0 has no effect */
+    }
+    else if(SYSTICK_CURRENT_REG_ADDRESS == Address)
+    {
+        Reg_SimSystem.systick_current = 0U; /* Any write clears the counter */
+    }
+    else if(NULL_PTR != reg)
+    {
+        *reg = Value;
+    }
+    else
+    {
+        Reg_SimFaults++;    /* SYSCTL_PRGPIO is read-only or the address is out of the model */
+    }
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimSetInput
+ * Description: Drive the external level of one pin, the edges of the edge sensitive pins are
+ *              latched in GPIORIS (both edges with GPIOIBE, else the GPIOIEV edge only).
+ ************************************************************************************/
+void Reg_SimSetInput(uint8 PortId, uint8 PinNum, uint8 Level)
+{
+    Reg_SimPortType * port = &Reg_SimPorts[PortId];
+    uint32 before = Reg_SimPadLevel(port);
+    uint32 changed;
+    uint32 rising;
+
+    if(STD_HIGH == Level)
+    {
+        SET_BIT(port->input, PinNum);
+    }
+    else
+    {
+        CLEAR_BIT(port->input, PinNum);
+    }
+
+    changed = (before ^ Reg_SimPadLevel(port)) & ~port->is;
+    rising  = changed & Reg_SimPadLevel(port);
+    port->ris |= (changed & port->ibe) | (changed & ~port->ibe & ~(rising ^ port->iev));
+    Reg_SimUpdateLevelInterrupts(port);
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimClearCounters
+ * Description: Clear the access counters of all the registers.
+ ************************************************************************************/
+void Reg_SimClearCounters(void)
+{
+    Reg_SimCountedRegisters = 0U;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimGetReadCount
+ * Description: Number of reads of the register at Address since the last clear.
+ ************************************************************************************/
+uint32 Reg_SimGetReadCount(uint32 Address)
+{
+    uint32 reads = 0U;
+    uint8 index;
+
+    Address = Reg_SimCounterAddress(Address);
+    for(index = 0U; index < Reg_SimCountedRegisters; index++)
+    {
+        if(Reg_SimCounters[index].address == Address)
+        {
+            reads = Reg_SimCounters[index].reads;
+        }
+    }
+    return reads;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimGetWriteCount
+ * Description: Number of writes of the register at Address since the last clear.
+ ************************************************************************************/
+uint32 Reg_SimGetWriteCount(uint32 Address)
+{
+    uint32 writes = 0U;
+    uint8 index;
+
+    Address = Reg_SimCounterAddress(Address);
+    for(index = 0U; index < Reg_SimCountedRegisters; index++)
+    {
+        if(Reg_SimCounters[index].address == Address)
+        {
+            writes = Reg_SimCounters[index].writes;
+        }
+    }
+    return writes;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimGetCountedRegisters
+ * Description: Number of different registers accessed since the last clear.
+ ************************************************************************************/
+uint8 Reg_SimGetCountedRegisters(void)
+{
+    return Reg_SimCountedRegisters;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimGetCounter
+ * Description: Address and access counters of the Index-th accessed register.
+ ************************************************************************************/
+void Reg_SimGetCounter(uint8 Index, uint32 * AddressPtr, uint32 * ReadsPtr, uint32 * WritesPtr)
+{
+    *AddressPtr = Reg_SimCounters[Index].address;
+    *ReadsPtr   = Reg_SimCounters[Index].reads;
+    *WritesPtr  = Reg_SimCounters[Index].writes;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimGetName
+ * Description: Name of the register at Address, the GPIODATA aliases are named DATA.
+ ************************************************************************************/
+const char * Reg_SimGetName(uint32 Address)
+{
+    uint8 portIndex = Reg_SimPortIndex(Address);
+    const char * result = "UNKNOWN";
+    uint8 index;
+
+    if(portIndex < REG_SIM_NUMBER_OF_PORTS)
+    {
+        Address = Reg_SimCounterAddress(Address) - Reg_SimPortBase[portIndex];
+        for(index = 0U; index < REG_SIM_NUMBER_OF_GPIO_REGS; index++)
+        {
+            if(Reg_SimGpioNames[index].offset == Address)
+            {
+                if('\0' == Reg_SimGpioFullNames[portIndex][index][0])
+                {
+                    (void)snprintf(Reg_SimGpioFullNames[portIndex][index], sizeof(Reg_SimGpioFullNames[portIndex][index]),
+                                   "GPIO%c_%s", (char)('A' + portIndex), Reg_SimGpioNames[index].name);
+                }
+                result = Reg_SimGpioFullNames[portIndex][index];
+            }
+        }
+    }
+    else
+    {
+        for(index = 0U; index < (sizeof(Reg_SimSystemNames) / sizeof(Reg_SimSystemNames[0])); index++)
+        {
+            if(Reg_SimSystemNames[index].address == Address)
+            {
+                result = Reg_SimSystemNames[index].name;
+            }
+        }
+    }
+    return result;
+}
+
+/************************************************************************************
+ * Function Name: Reg_SimGetFaultCount
+ * Description: Number of invalid accesses since the last reset.
+ ************************************************************************************/
+uint32 Reg_SimGetFaultCount(void)
+{
+    return Reg_SimFaults;
+}
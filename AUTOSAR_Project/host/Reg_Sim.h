@@ -0,0 +1,90 @@
+ /******************************************************************************
+ *
+ * Module: Reg_Sim
+ *
+ * File Name: Reg_Sim.h
+ *
+ * Description: Header file for the host model of the TM4C123GH6PM registers
+ *              used by the drivers (GPIO ports A to F, SYSCTL RCGCGPIO/PRGPIO,
+ *              SysTick, NVIC and DWT). The drivers reach it through REG_READ and
+ *              REG_WRITE of Reg_Access.h when REG_ACCESS_SIMULATION is defined.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#ifndef REG_SIM_H
+#define REG_SIM_H
+
+#include "Std_Types.h"
+
+/* Number of GPIO ports of the model */
+#define REG_SIM_NUMBER_OF_PORTS          (6U)
+
+/*
+ * Register offsets of a GPIO port from the TM4C123GH6PM data sheet, the model does not take them
+ * from the driver headers so a driver write to an offset out of this list is counted as a fault
+ */
+#define REG_SIM_GPIO_DATA_OFFSET         (0x3FCU)
+#define REG_SIM_GPIO_DIR_OFFSET          (0x400U)
+#define REG_SIM_GPIO_IS_OFFSET           (0x404U)
+#define REG_SIM_GPIO_IBE_OFFSET          (0x408U)
+#define REG_SIM_GPIO_IEV_OFFSET          (0x40CU)
+#define REG_SIM_GPIO_IM_OFFSET           (0x410U)
+#define REG_SIM_GPIO_RIS_OFFSET          (0x414U)
+#define REG_SIM_GPIO_MIS_OFFSET          (0x418U)
+#define REG_SIM_GPIO_ICR_OFFSET          (0x41CU)
+#define REG_SIM_GPIO_AFSEL_OFFSET        (0x420U)
+#define REG_SIM_GPIO_PUR_OFFSET          (0x510U)
+#define REG_SIM_GPIO_PDR_OFFSET          (0x514U)
+#define REG_SIM_GPIO_DEN_OFFSET          (0x51CU)
+#define REG_SIM_GPIO_LOCK_OFFSET         (0x520U)
+#define REG_SIM_GPIO_CR_OFFSET           (0x524U)
+#define REG_SIM_GPIO_AMSEL_OFFSET        (0x528U)
+#define REG_SIM_GPIO_PCTL_OFFSET         (0x52CU)
+
+/* Value written to GPIOLOCK to unlock GPIOCR */
+#define REG_SIM_GPIO_LOCK_KEY            (0x4C4F434BU)
+
+/* Address of the register at OFFSET of the port PORT_ID (0 for port A to 5 for port F) */
+#define REG_SIM_GPIO_ADDRESS(PORT_ID, OFFSET) \
+    ((((PORT_ID) < 4U) ? (0x40004000U + ((uint32)(PORT_ID) * 0x1000U)) : (0x40024000U + ((uint32)((PORT_ID) - 4U) * 0x1000U))) + (uint32)(OFFSET))
+
+/* Maximum number of different registers counted between two Reg_SimClearCounters calls ... all the registers of the model */
+#define REG_SIM_MAX_COUNTED_REGISTERS    (128U)
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Put all the registers in their reset state and clear the access counters */
+void Reg_SimReset(void);
+
+/* Register accesses of the drivers (REG_READ/REG_WRITE) ... each one is counted */
+uint32 Reg_SimRead(uint32 Address);
+void Reg_SimWrite(uint32 Address, uint32 Value);
+
+/* Value of a register without side effects and without counting the access */
+uint32 Reg_SimPeek(uint32 Address);
+
+/* Drive the external level of an input pin, edges are latched in GPIORIS */
+void Reg_SimSetInput(uint8 PortId, uint8 PinNum, uint8 Level);
+
+/* Access counters of the register at Address, the GPIODATA aliases are counted on GPIODATA (base + 0x3FC) */
+void Reg_SimClearCounters(void);
+uint32 Reg_SimGetReadCount(uint32 Address);
+uint32 Reg_SimGetWriteCount(uint32 Address);
+
+/* Number of different registers accessed since the last clear and their counters by index */
+uint8 Reg_SimGetCountedRegisters(void);
+void Reg_SimGetCounter(uint8 Index, uint32 * AddressPtr, uint32 * ReadsPtr, uint32 * WritesPtr);
+
+/* Name of the register at Address (e.g. "GPIOF_DIR"), "UNKNOWN" for the registers out of the model */
+const char * Reg_SimGetName(uint32 Address);
+
+/*
+ * Number of invalid accesses: a GPIO access while the port clock is gated, a write to a
+ * read-only register, an access to an address out of the model or an access that could not be counted
+ */
+uint32 Reg_SimGetFaultCount(void);
+
+#endif /* REG_SIM_H */
@@ -0,0 +1,582 @@
+ /******************************************************************************
+ *
+ * Module: Reg_Sim
+ *
+ * File Name: Reg_Sim_Test.c
+ *
+ * Description: Host test of the register model and of the Mcu, Port and Dio
+ *              drivers running on top of it.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Reg_Sim.h"
+#include "Det_Sim.h"
+#include "Mcu.h"
+#include "Port.h"
+#include "Dio.h"
+#include "tm4c123gh6pm_registers.h"
+
+uint32 Test_Failures = 0U;
+
+/* Edge interrupt handler of port F (Port.c) */
+extern void GPIOPortF_Handler(void);
+
+STATIC uint8 Test_EdgeCount = 0U;
+
+STATIC void Test_EdgeCallBack(void)
+{
+    Test_EdgeCount++;
+}
+
+/* Registers repaired in each port as reported to the repair call back */
+STATIC uint8 Test_RepairedRegisters[PORT_NUMBER_OF_PORTS];
+
+STATIC void Test_RepairCallBack(uint8 PortId, uint8 RepairedRegisters)
+{
+    Test_RepairedRegisters[PortId] += RepairedRegisters;
+}
+
+/* Total reads or writes of all the registers accessed since the last Reg_SimClearCounters */
+STATIC uint32 Test_CountAccesses(boolean Writes)
+{
+    uint32 address, reads, writes;
+    uint32 total = 0U;
+    uint8 index;
+
+    for(index = 0U; index < Reg_SimGetCountedRegisters(); index++)
+    {
+        Reg_SimGetCounter(index, &address, &reads, &writes);
+        total += (TRUE == Writes) ? writes : reads;
+    }
+    return total;
+}
+
+/* Address of the register at OFFSET of port A, port B and port F */
+#define TEST_PORTA_REG(OFFSET)    REG_SIM_GPIO_ADDRESS(PORT_PORTA_ID, OFFSET)
+#define TEST_PORTB_REG(OFFSET)    REG_SIM_GPIO_ADDRESS(PORT_PORTB_ID, OFFSET)
+#define TEST_PORTF_REG(OFFSET)    REG_SIM_GPIO_ADDRESS(PORT_PORTF_ID, OFFSET)
+
+/* Index of PF0 in the pins table ... the port F pins are listed in order up to SW1 (PF4) */
+#define TEST_PF0_PIN_ID_INDEX     ((Port_PinType)(PortConf_SW1_PIN_ID_INDEX - 4U))
+
+/************************************************************************************
+ * Clock gating of the ports and the read-only SYSCTL_PRGPIO
+ ************************************************************************************/
+STATIC void Test_Clock(void)
+{
+    Reg_SimReset();
+    (void)Reg_SimRead(TEST_PORTA_REG(REG_SIM_GPIO_DIR_OFFSET));
+    TEST_CHECK(1U == Reg_SimGetFaultCount());   /* the clock of port A is gated at reset */
+
+    Reg_SimReset();
+    Mcu_Init();
+    TEST_CHECK(0x3FU == Reg_SimPeek(SYSCTL_PRGPIO_REG_ADDRESS));
+    TEST_CHECK(0U == Reg_SimGetFaultCount());
+
+    Reg_SimWrite(SYSCTL_PRGPIO_REG_ADDRESS, 0U);
+    TEST_CHECK(0x3FU == Reg_SimPeek(SYSCTL_PRGPIO_REG_ADDRESS));
+    TEST_CHECK(1U == Reg_SimGetFaultCount());
+}
+
+/************************************************************************************
+ * GPIODATA address masking
+ ************************************************************************************/
+STATIC void Test_DataMasking(void)
+{
+    Reg_SimReset();
+    Mcu_Init();
+    Reg_SimWrite(TEST_PORTA_REG(REG_SIM_GPIO_DEN_OFFSET), 0xFFU);
+    Reg_SimWrite(TEST_PORTA_REG(REG_SIM_GPIO_DIR_OFFSET), 0xFFU);
+
+    Reg_SimWrite(TEST_PORTA_REG(0x02U << 2), 0xFFU);        /* only pin 1 is written */
+    TEST_CHECK(0x02U == Reg_SimPeek(TEST_PORTA_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    Reg_SimWrite(TEST_PORTA_REG(0x81U << 2), 0x01U);        /* pin 0 set, pin 7 cleared */
+    TEST_CHECK(0x03U == Reg_SimPeek(TEST_PORTA_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(0x01U == Reg_SimRead(TEST_PORTA_REG(0x05U << 2)));   /* pin 1 is read as 0 */
+
+    /* All the aliases are counted on GPIODATA */
+    TEST_CHECK(2U == Reg_SimGetWriteCount(TEST_PORTA_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(1U == Reg_SimGetReadCount(TEST_PORTA_REG(0x10U << 2)));
+}
+
+/************************************************************************************
+ * GPIOLOCK/GPIOCR protection of PF0
+ ************************************************************************************/
+STATIC void Test_LockCommit(void)
+{
+    Reg_SimReset();
+    Mcu_Init();
+    TEST_CHECK(0xFEU == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_CR_OFFSET)));
+
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_CR_OFFSET), 0xFFU);        /* ignored while locked */
+    TEST_CHECK(0xFEU == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_CR_OFFSET)));
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_DEN_OFFSET), 0xFFU);
+    TEST_CHECK(0xFEU == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DEN_OFFSET)));
+
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_LOCK_OFFSET), REG_SIM_GPIO_LOCK_KEY);
+    TEST_CHECK(0U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_LOCK_OFFSET)));
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_CR_OFFSET), 0xFFU);
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_LOCK_OFFSET), 0U);           /* any other value locks again */
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_DEN_OFFSET), 0xFFU);
+    TEST_CHECK(0xFFU == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DEN_OFFSET)));
+    TEST_CHECK(0U == Reg_SimGetFaultCount());
+}
+
+/************************************************************************************
+ * Port APIs called before Port_Init
+ ************************************************************************************/
+STATIC void Test_PortUninit(void)
+{
+    Det_SimClear();
+    Port_SetRepairCallBack(Test_RepairCallBack);
+    TEST_CHECK(PORT_SET_REPAIR_CALL_BACK_SID == Det_SimLastApiId);
+    TEST_CHECK(PORT_E_UNINIT == Det_SimLastErrorId);
+    TEST_CHECK(0U == Port_VerifyAndRepair());
+    TEST_CHECK(PORT_VERIFY_AND_REPAIR_SID == Det_SimLastApiId);
+    TEST_CHECK(PORT_E_UNINIT == Det_SimLastErrorId);
+
+    /* Only the UNINIT error ... the configuration is not read before Port_Init */
+    Port_SetPinDirection(0U, PORT_PIN_OUT);
+    TEST_CHECK(PORT_SET_PIN_DIRECTION_SID == Det_SimLastApiId);
+    TEST_CHECK(PORT_E_UNINIT == Det_SimLastErrorId);
+    TEST_CHECK(3U == Det_SimErrorCount);
+}
+
+/* Reset the model and initialize Mcu, Port and Dio with their configurations */
+STATIC void Test_InitDrivers(void)
+{
+    Reg_SimReset();
+    Det_SimClear();
+    Mcu_Init();
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+}
+
+/************************************************************************************
+ * Port_Init, Dio channel accesses and the PF4 edge interrupt
+ ************************************************************************************/
+STATIC void Test_Drivers(void)
+{
+    Test_InitDrivers();
+
+    TEST_CHECK(0U == Det_SimErrorCount);
+    TEST_CHECK(0U == Reg_SimGetFaultCount());
+    TEST_CHECK(0x0EU == (Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DIR_OFFSET)) & 0x1FU));  /* PF1-PF3 outputs */
+    TEST_CHECK(0x10U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_PUR_OFFSET)));            /* SW1 pull-up */
+    TEST_CHECK(0x1FU == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DEN_OFFSET)));            /* PF0 committed */
+    TEST_CHECK(1U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_LOCK_OFFSET)));              /* locked again */
+    TEST_CHECK(0U != (Reg_SimPeek(NVIC_EN0_REG_ADDRESS) & ((uint32)1 << 30)));              /* port F IRQ enabled */
+
+    /* One store to the channel masked address, the other pins of the port are not touched */
+    Reg_SimClearCounters();
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+    TEST_CHECK(1U == Reg_SimGetWriteCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(0U == Reg_SimGetReadCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(1U == Reg_SimGetCountedRegisters());
+    TEST_CHECK(0x02U == (Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)) & 0x0EU));
+
+    Reg_SimSetInput(PORT_PORTF_ID, PORT_PIN4_ID, STD_HIGH);
+    TEST_CHECK(STD_HIGH == Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+    Reg_SimSetInput(PORT_PORTF_ID, PORT_PIN4_ID, STD_LOW);
+    TEST_CHECK(STD_LOW == Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+    TEST_CHECK(0U == Det_SimErrorCount);
+
+    /* Both edges of SW1 are latched, the handler serves and clears them */
+    Port_SetEdgeCallBack(PortConf_SW1_PIN_ID_INDEX, Test_EdgeCallBack);
+    TEST_CHECK(0x10U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_MIS_OFFSET)));
+    GPIOPortF_Handler();
+    TEST_CHECK(1U == Test_EdgeCount);
+    TEST_CHECK(0U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_MIS_OFFSET)));
+}
+
+/************************************************************************************
+ * Dio_ReadPort and Dio_WritePort
+ ************************************************************************************/
+STATIC void Test_DioPort(void)
+{
+    uint8 index;
+
+    Test_InitDrivers();
+
+    /* One store for the 8 pins, the inputs PF0 and PF4 keep their external level */
+    Reg_SimClearCounters();
+    Dio_WritePort(DioConf_LED1_PORT_NUM, 0xFFU);
+    TEST_CHECK(1U == Reg_SimGetWriteCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(0U == Reg_SimGetReadCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(1U == Reg_SimGetCountedRegisters());
+    TEST_CHECK(0x0EU == (Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)) & 0x1FU));
+
+    /* One load for the 8 pins */
+    Reg_SimSetInput(PORT_PORTF_ID, PORT_PIN4_ID, STD_HIGH);
+    Reg_SimClearCounters();
+    TEST_CHECK(0x1EU == (Dio_ReadPort(DioConf_SW1_PORT_NUM) & 0x1FU));
+    TEST_CHECK(1U == Reg_SimGetReadCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(0U == Reg_SimGetWriteCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(1U == Reg_SimGetCountedRegisters());
+
+    /* Writing 8 pins one channel at a time costs 8 stores where Dio_WritePort costs 1
+     * (the LED channel stands for each of the 8 channels of the port) */
+    Reg_SimClearCounters();
+    for(index = 0U; index < 8U; index++)
+    {
+        Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+    }
+    TEST_CHECK(8U == Reg_SimGetWriteCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    Reg_SimClearCounters();
+    Dio_WritePort(DioConf_LED1_PORT_NUM, 0x00U);
+    TEST_CHECK(1U == Reg_SimGetWriteCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(0U == Det_SimErrorCount);
+
+    /* An invalid port is reported and not accessed */
+    Reg_SimClearCounters();
+    TEST_CHECK(0U == Dio_ReadPort((Dio_PortType)DIO_NUMBER_OF_PORTS));
+    TEST_CHECK(DIO_READ_PORT_SID == Det_SimLastApiId);
+    TEST_CHECK(DIO_E_PARAM_INVALID_PORT_ID == Det_SimLastErrorId);
+    Dio_WritePort((Dio_PortType)DIO_NUMBER_OF_PORTS, 0xFFU);
+    TEST_CHECK(DIO_WRITE_PORT_SID == Det_SimLastApiId);
+    TEST_CHECK(DIO_E_PARAM_INVALID_PORT_ID == Det_SimLastErrorId);
+    TEST_CHECK(2U == Det_SimErrorCount);
+    TEST_CHECK(0U == Reg_SimGetCountedRegisters());
+}
+
+/************************************************************************************
+ * Dio_ReadChannelGroup and Dio_WriteChannelGroup
+ ************************************************************************************/
+STATIC void Test_DioChannelGroup(void)
+{
+    Dio_ChannelGroupType invalidGroup = {0x0EU, 1U, DIO_NUMBER_OF_PORTS};
+
+    Test_InitDrivers();
+
+    /* PF4 is made an output so the pins out of the RGB group mask (PF1-PF3) can be checked */
+    Port_SetPinDirection(PortConf_SW1_PIN_ID_INDEX, PORT_PIN_OUT);
+    Dio_WriteChannel(DioConf_SW1_CHANNEL_ID_INDEX, STD_HIGH);
+
+    /* One store, the level is shifted by the group offset and the bits out of the mask are ignored */
+    Reg_SimClearCounters();
+    Dio_WriteChannelGroup(DioConf_RGB_LED_GROUP_PTR, 0xF5U);
+    TEST_CHECK(1U == Reg_SimGetWriteCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(0U == Reg_SimGetReadCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(1U == Reg_SimGetCountedRegisters());
+    TEST_CHECK(0x1AU == (Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)) & 0x1EU));   /* PF1 and PF3 set, PF4 kept high */
+
+    Dio_WriteChannel(DioConf_SW1_CHANNEL_ID_INDEX, STD_LOW);
+    Dio_WriteChannelGroup(DioConf_RGB_LED_GROUP_PTR, 0xFFU);
+    TEST_CHECK(0x0EU == (Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)) & 0x1EU));   /* PF4 kept low */
+
+    /* One load, the group pins are shifted down to bit 0 */
+    Dio_WriteChannelGroup(DioConf_RGB_LED_GROUP_PTR, 0x06U);
+    Reg_SimClearCounters();
+    TEST_CHECK(0x06U == Dio_ReadChannelGroup(DioConf_RGB_LED_GROUP_PTR));
+    TEST_CHECK(1U == Reg_SimGetReadCount(TEST_PORTF_REG(REG_SIM_GPIO_DATA_OFFSET)));
+    TEST_CHECK(1U == Reg_SimGetCountedRegisters());
+    TEST_CHECK(0U == Det_SimErrorCount);
+
+    /* A NULL or invalid group is reported and not accessed */
+    Reg_SimClearCounters();
+    TEST_CHECK(0U == Dio_ReadChannelGroup(NULL_PTR));
+    TEST_CHECK(DIO_READ_CHANNEL_GROUP_SID == Det_SimLastApiId);
+    TEST_CHECK(DIO_E_PARAM_POINTER == Det_SimLastErrorId);
+    Dio_WriteChannelGroup(NULL_PTR, 0x07U);
+    TEST_CHECK(DIO_WRITE_CHANNEL_GROUP_SID == Det_SimLastApiId);
+    TEST_CHECK(DIO_E_PARAM_POINTER == Det_SimLastErrorId);
+    TEST_CHECK(0U == Dio_ReadChannelGroup(&invalidGroup));
+    TEST_CHECK(DIO_READ_CHANNEL_GROUP_SID == Det_SimLastApiId);
+    TEST_CHECK(DIO_E_PARAM_INVALID_GROUP == Det_SimLastErrorId);
+    Dio_WriteChannelGroup(&invalidGroup, 0x07U);
+    TEST_CHECK(DIO_WRITE_CHANNEL_GROUP_SID == Det_SimLastApiId);
+    TEST_CHECK(DIO_E_PARAM_INVALID_GROUP == Det_SimLastErrorId);
+    TEST_CHECK(4U == Det_SimErrorCount);
+    TEST_CHECK(0U == Reg_SimGetCountedRegisters());
+}
+
+/************************************************************************************
+ * Port_RefreshPortDirection of drifted GPIODIR bits
+ ************************************************************************************/
+STATIC void Test_RefreshDirectionDrift(void)
+{
+    uint32 dir;
+
+    Test_InitDrivers();
+    dir = Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DIR_OFFSET));
+
+    /* PF1 drifts to input, PF4 to output and PF5, which is not configured, is set */
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_DIR_OFFSET), dir ^ 0x32U);
+    Reg_SimClearCounters();
+    Port_RefreshPortDirection();
+
+    /* Port F is written once with only the drifted configured pins flipped back, the other ports are only read */
+    TEST_CHECK((dir | 0x20U) == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DIR_OFFSET)));
+    TEST_CHECK(1U == Reg_SimGetWriteCount(TEST_PORTF_REG(REG_SIM_GPIO_DIR_OFFSET)));
+    TEST_CHECK(0U == Reg_SimGetWriteCount(TEST_PORTA_REG(REG_SIM_GPIO_DIR_OFFSET)));
+    TEST_CHECK(1U == Reg_SimGetReadCount(TEST_PORTA_REG(REG_SIM_GPIO_DIR_OFFSET)));
+    TEST_CHECK(PORT_NUMBER_OF_PORTS == Reg_SimGetCountedRegisters());
+    TEST_CHECK(0x12U == Port_GetDirectionDrift(PORT_PORTF_ID));
+    TEST_CHECK(0U == Port_GetDirectionDrift(PORT_PORTA_ID));
+
+    /* Nothing drifted since the last refresh ... no write */
+    Reg_SimClearCounters();
+    Port_RefreshPortDirection();
+    TEST_CHECK(0U == Reg_SimGetWriteCount(TEST_PORTF_REG(REG_SIM_GPIO_DIR_OFFSET)));
+    TEST_CHECK(0U == Port_GetDirectionDrift(PORT_PORTF_ID));
+    TEST_CHECK(0U == Det_SimErrorCount);
+
+    (void)Port_GetDirectionDrift(PORT_NUMBER_OF_PORTS);
+    TEST_CHECK(PORT_E_PARAM_PORT == Det_SimLastErrorId);
+}
+
+/************************************************************************************
+ * Port_VerifyAndRepair of injected register faults
+ ************************************************************************************/
+STATIC void Test_VerifyAndRepair(void)
+{
+    uint8 portIndex;
+
+    Test_InitDrivers();
+    Port_SetRepairCallBack(Test_RepairCallBack);
+    for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
+    {
+        Test_RepairedRegisters[portIndex] = 0U;
+    }
+
+    /* SW1 loses its pull-up, PF1 its digital enable and PB2 turns to its alternate function,
+     * PF5 which is not configured gets a pull-up that has to be kept */
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_PUR_OFFSET), 0x20U);
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_DEN_OFFSET), Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DEN_OFFSET)) & ~0x02U);
+    Reg_SimWrite(TEST_PORTB_REG(REG_SIM_GPIO_AFSEL_OFFSET), 0x04U);
+
+    /* Each register of each port is read once, only the 3 drifted registers are written */
+    Reg_SimClearCounters();
+    TEST_CHECK(3U == Port_VerifyAndRepair());
+    TEST_CHECK((7U * PORT_NUMBER_OF_PORTS) == Test_CountAccesses(FALSE));
+    TEST_CHECK(3U == Test_CountAccesses(TRUE));
+    TEST_CHECK(0x30U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_PUR_OFFSET)));
+    TEST_CHECK(0x1FU == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DEN_OFFSET)));
+    TEST_CHECK(0U == Reg_SimPeek(TEST_PORTB_REG(REG_SIM_GPIO_AFSEL_OFFSET)));
+
+    /* The call back gets the repaired registers of each port */
+    TEST_CHECK(0U == Test_RepairedRegisters[PORT_PORTA_ID]);
+    TEST_CHECK(1U == Test_RepairedRegisters[PORT_PORTB_ID]);
+    TEST_CHECK(2U == Test_RepairedRegisters[PORT_PORTF_ID]);
+
+    /* Nothing drifted since the last call ... no write and no call back */
+    Reg_SimClearCounters();
+    TEST_CHECK(0U == Port_VerifyAndRepair());
+    TEST_CHECK(0U == Test_CountAccesses(TRUE));
+    TEST_CHECK(2U == Test_RepairedRegisters[PORT_PORTF_ID]);
+    TEST_CHECK(0U == Det_SimErrorCount);
+    TEST_CHECK(0U == Reg_SimGetFaultCount());
+}
+
+/************************************************************************************
+ * Port_SetPinDirection of a pin out of the pins table
+ ************************************************************************************/
+STATIC void Test_SetPinDirectionInvalidPin(void)
+{
+    Test_InitDrivers();
+    Reg_SimClearCounters();
+
+    /* One PARAM_PIN error and no register access ... the pins table is not read out of its bounds */
+    Port_SetPinDirection(PORT_CONFIGURED_PINS, PORT_PIN_OUT);
+    TEST_CHECK(1U == Det_SimErrorCount);
+    TEST_CHECK(PORT_SET_PIN_DIRECTION_SID == Det_SimLastApiId);
+    TEST_CHECK(PORT_E_PARAM_PIN == Det_SimLastErrorId);
+    TEST_CHECK(0U == Reg_SimGetCountedRegisters());
+}
+
+/************************************************************************************
+ * Port_SaveContext and Port_RestoreContext round trip with the interrupt registers
+ ************************************************************************************/
+STATIC void Test_ContextRoundTrip(void)
+{
+    Port_ContextType context;
+    uint32 initAccesses;
+    uint32 restoreReads;
+    uint32 restoreAccesses;
+
+    /* Accesses of Port_Init from the reset state */
+    Reg_SimReset();
+    Det_SimClear();
+    Mcu_Init();
+    Reg_SimClearCounters();
+    Port_Init(&Port_Configuration);
+    initAccesses = Test_CountAccesses(FALSE) + Test_CountAccesses(TRUE);
+    Dio_Init(&Dio_Configuration);
+
+    /* Runtime changes before the save ... SW1 interrupts on one edge only and is an output */
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_IBE_OFFSET), 0x00U);
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_IEV_OFFSET), 0x00U);
+    Port_SetPinDirection(PortConf_SW1_PIN_ID_INDEX, PORT_PIN_OUT);
+    Port_SaveContext(&context);
+    TEST_CHECK(0x00U == context.Port[PORT_PORTF_ID].ibe);
+    TEST_CHECK(0x10U == context.Port[PORT_PORTF_ID].im);
+    TEST_CHECK(0x1EU == context.Port[PORT_PORTF_ID].dir);
+
+    /* Lost state in the low-power mode ... SW1 masked, level sensitive and back to input */
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_IM_OFFSET), 0x00U);
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_IS_OFFSET), 0x10U);
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_IBE_OFFSET), 0x10U);
+    Reg_SimWrite(TEST_PORTF_REG(REG_SIM_GPIO_DIR_OFFSET), 0x0EU);
+
+    Reg_SimClearCounters();
+    Port_RestoreContext(&context);
+    restoreReads = Test_CountAccesses(FALSE);
+    restoreAccesses = restoreReads + Test_CountAccesses(TRUE);
+
+    TEST_CHECK(0x00U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_IS_OFFSET)));
+    TEST_CHECK(0x00U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_IBE_OFFSET)));
+    TEST_CHECK(0x00U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_IEV_OFFSET)));
+    TEST_CHECK(0x10U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_IM_OFFSET)));
+    TEST_CHECK(0x1EU == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DIR_OFFSET)));
+    TEST_CHECK(0x10U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_PUR_OFFSET)));
+    TEST_CHECK(0x1FU == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DEN_OFFSET)));
+
+    /* The saved registers are whole ... the restore only writes and takes fewer accesses than Port_Init */
+    TEST_CHECK(0U == restoreReads);
+    TEST_CHECK(restoreAccesses < initAccesses);
+    TEST_CHECK(0U == Det_SimErrorCount);
+    TEST_CHECK(0U == Reg_SimGetFaultCount());
+}
+
+/************************************************************************************
+ * Port_SwitchVariant between every pair of variants
+ ************************************************************************************/
+/* Check the registers of the configured pins of a port against a register image */
+STATIC void Test_CheckPortImage(uint8 PortId, const Port_PortImageType * Image)
+{
+    uint32 pin_mask = (uint32)Image->pin_mask;
+    uint32 pctl_mask = 0U;
+    uint8 pin;
+
+    for(pin = 0U; pin < 8U; pin++)
+    {
+        if(0U != (pin_mask & ((uint32)1 << pin)))
+        {
+            pctl_mask |= (uint32)0xF << (pin * 4U);
+        }
+    }
+
+    TEST_CHECK(Image->dir   == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_DIR_OFFSET)) & pin_mask));
+    TEST_CHECK(Image->pur   == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_PUR_OFFSET)) & pin_mask));
+    TEST_CHECK(Image->pdr   == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_PDR_OFFSET)) & pin_mask));
+    TEST_CHECK(Image->amsel == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_AMSEL_OFFSET)) & pin_mask));
+    TEST_CHECK(Image->afsel == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_AFSEL_OFFSET)) & pin_mask));
+    TEST_CHECK(Image->pctl  == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_PCTL_OFFSET)) & pctl_mask));
+    TEST_CHECK(Image->den   == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_DEN_OFFSET)) & pin_mask));
+    TEST_CHECK(Image->is    == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_IS_OFFSET)) & pin_mask));
+    TEST_CHECK(Image->ibe   == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_IBE_OFFSET)) & pin_mask));
+    TEST_CHECK(Image->iev   == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_IEV_OFFSET)) & pin_mask));
+    TEST_CHECK(Image->im    == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_IM_OFFSET)) & pin_mask));
+
+    /* The initial level of the output pins */
+    TEST_CHECK((Image->data & Image->dir) == (Reg_SimPeek(REG_SIM_GPIO_ADDRESS(PortId, REG_SIM_GPIO_DATA_OFFSET)) & Image->dir));
+}
+
+STATIC void Test_SwitchVariantPairs(void)
+{
+    const Port_ConfigType * target;
+    uint8 from;
+    uint8 to;
+    uint8 portIndex;
+
+    for(from = 0U; from < PORT_NUMBER_OF_VARIANTS; from++)
+    {
+        for(to = 0U; to < PORT_NUMBER_OF_VARIANTS; to++)
+        {
+            if(from == to)
+            {
+                /* Port_SwitchVariant does nothing for the applied variant */
+                continue;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+
+            /* Start from the registers of the first variant as Port_Init left them */
+            Reg_SimReset();
+            Det_SimClear();
+            Mcu_Init();
+            Port_Init(Port_Variants[from]);
+
+            Port_SwitchVariant(to);
+
+            target = Port_Variants[to];
+            for(portIndex = PORT_PORTA_ID; portIndex < PORT_NUMBER_OF_PORTS; portIndex++)
+            {
+                Test_CheckPortImage(portIndex, &target->Port[portIndex]);
+            }
+            TEST_CHECK(0U == Det_SimErrorCount);
+            TEST_CHECK(0U == Reg_SimGetFaultCount());
+        }
+    }
+
+    /* Port_Init of the normal variant for the next tests */
+    Test_InitDrivers();
+}
+
+/************************************************************************************
+ * Port_Init from the packed pins table
+ ************************************************************************************/
+STATIC void Test_PortInitPackedTable(void)
+{
+    Port_ConfigPin pf0 = Port_Configuration.Pin[TEST_PF0_PIN_ID_INDEX];
+    Port_ConfigPin sw1 = Port_Configuration.Pin[PortConf_SW1_PIN_ID_INDEX];
+
+    /* The packed entries of PF0 and SW1 */
+    TEST_CHECK(PORT_PORTF_ID == PORT_PIN_CFG_PORT_NUM(pf0));
+    TEST_CHECK(PORT_PIN0_ID == PORT_PIN_CFG_PIN_NUM(pf0));
+    TEST_CHECK(PORT_PORTF_ID == PORT_PIN_CFG_PORT_NUM(sw1));
+    TEST_CHECK(PORT_PIN4_ID == PORT_PIN_CFG_PIN_NUM(sw1));
+    TEST_CHECK(PULL_UP == PORT_PIN_CFG_RESISTOR(sw1));
+
+    Test_InitDrivers();
+
+    /* PF0 is committed, configured as a digital input and GPIOCR is locked again */
+    TEST_CHECK(0x01U == (Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_CR_OFFSET)) & 0x01U));
+    TEST_CHECK(1U == Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_LOCK_OFFSET)));
+    TEST_CHECK(0x01U == (Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DEN_OFFSET)) & 0x01U));
+    TEST_CHECK(0x00U == (Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_DIR_OFFSET)) & 0x01U));
+
+    /* SW1 pull-up and no pull-down */
+    TEST_CHECK(0x10U == (Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_PUR_OFFSET)) & 0x10U));
+    TEST_CHECK(0x00U == (Reg_SimPeek(TEST_PORTF_REG(REG_SIM_GPIO_PDR_OFFSET)) & 0x10U));
+
+    /* PA0 and PA1 are DIO in the normal variant ... PMC0 and PMC1 are zero */
+    TEST_CHECK(0x00U == (Reg_SimPeek(TEST_PORTA_REG(REG_SIM_GPIO_PCTL_OFFSET)) & 0xFFU));
+    TEST_CHECK(0x00U == (Reg_SimPeek(TEST_PORTA_REG(REG_SIM_GPIO_AFSEL_OFFSET)) & 0x03U));
+
+    /* PA0 and PA1 are U0Rx and U0Tx in the diagnostic variant ... PMC0 and PMC1 are 1 */
+    Reg_SimReset();
+    Mcu_Init();
+    Port_Init(&Port_Configuration_Diagnostic);
+    TEST_CHECK(0x11U == (Reg_SimPeek(TEST_PORTA_REG(REG_SIM_GPIO_PCTL_OFFSET)) & 0xFFU));
+    TEST_CHECK(0x03U == (Reg_SimPeek(TEST_PORTA_REG(REG_SIM_GPIO_AFSEL_OFFSET)) & 0x03U));
+    TEST_CHECK(0U == Det_SimErrorCount);
+    TEST_CHECK(0U == Reg_SimGetFaultCount());
+
+    /* Port_Init of the normal variant for the next tests */
+    Test_InitDrivers();
+}
+
+int main(void)
+{
+    Test_Clock();
+    Test_DataMasking();
+    Test_LockCommit();
+    Test_PortUninit();
+    Test_Drivers();
+    Test_DioPort();
+    Test_DioChannelGroup();
+    Test_RefreshDirectionDrift();
+    Test_VerifyAndRepair();
+    Test_SetPinDirectionInvalidPin();
+    Test_ContextRoundTrip();
+    Test_SwitchVariantPairs();
+    Test_PortInitPackedTable();
+
+    printf("Reg_Sim_Test: %s (%u failed checks)\n", (0U == Test_Failures) ? "PASS" : "FAIL", (unsigned)Test_Failures);
+    return (0U == Test_Failures) ? 0 : 1;
+}
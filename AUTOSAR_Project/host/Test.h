@@ -0,0 +1,31 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test.h
+ *
+ * Description: Check macro of the host tests, a failed check is printed and
+ *              counted, the test program returns the number of failed checks.
+ *
+ * Author: Salma Hamdy
+ ******************************************************************************/
+
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+#include "Std_Types.h"
+
+extern uint32 Test_Failures;
+
+#define TEST_CHECK(COND) \
+    do \
+    { \
+        if(!(COND)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND); \
+            Test_Failures++; \
+        } \
+    } while(0)
+
+#endif /* TEST_H */
@@ -1,7 +1,7 @@
 #ifndef TM4C123GH6PM_REGISTERS
 #define TM4C123GH6PM_REGISTERS
 
-#include "std_types.h"
+#include "Std_Types.h"
 
 /*****************************************************************************
 GPIO registers (PORTA)
@@ -202,6 +202,13 @@ System Control Block Registers
 #define NVIC_SYSTEM_INTCTRL       (*((volatile uint32 *)0xE000ED04))
 #define NVIC_SYSTEM_CFGCTRL       (*((volatile uint32 *)0xE000ED14))
 
+/*****************************************************************************
+Debug Registers
+*****************************************************************************/
+#define DEBUG_DEMCR_REG           (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG              (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG            (*((volatile uint32 *)0xE0001004))
+
 /*****************************************************************************
 MPU Registers
 *****************************************************************************/
@@ -438,4 +445,19 @@ Flash Registers
 #define FLASH_FMPPE2_REG          (*((volatile uint32 *)0x400FE408))
 #define FLASH_FMPPE3_REG          (*((volatile uint32 *)0x400FE40C))
 
+/*****************************************************************************
+Addresses of the registers accessed by the drivers through REG_READ/REG_WRITE
+*****************************************************************************/
+#define SYSCTL_RCGCGPIO_REG_ADDRESS     0x400FE608U
+#define SYSCTL_PRGPIO_REG_ADDRESS       0x400FEA08U
+#define SYSTICK_CTRL_REG_ADDRESS        0xE000E010U
+#define SYSTICK_RELOAD_REG_ADDRESS      0xE000E014U
+#define SYSTICK_CURRENT_REG_ADDRESS     0xE000E018U
+#define NVIC_EN0_REG_ADDRESS            0xE000E100U
+#define NVIC_SYSTEM_INTCTRL_ADDRESS     0xE000ED04U
+#define NVIC_SYSTEM_PRI3_REG_ADDRESS    0xE000ED20U
+#define DEBUG_DEMCR_REG_ADDRESS         0xE000EDFCU
+#define DWT_CTRL_REG_ADDRESS            0xE0001000U
+#define DWT_CYCCNT_REG_ADDRESS          0xE0001004U
+
 #endif